@@ -29,7 +29,7 @@ AppsContainer::AppsContainer() :
 }
 
 bool AppsContainer::poincareCircuitBreaker() {
-  Ion::Keyboard::State state = Ion::Keyboard::scan();
+  Ion::Keyboard::State state = Ion::Keyboard::cachedScan();
   return state.keyDown(Ion::Keyboard::Key::A6);
 }
 
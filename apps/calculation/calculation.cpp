@@ -36,17 +36,6 @@ Calculation::~Calculation() {
   }
 }
 
-Calculation& Calculation::operator=(const Calculation& other) {
-  const char * otherInputText = other.m_inputText;
-  const char * otherExactOutputText = other.m_exactOutputText;
-  const char * otherApproximateOutputText = other.m_approximateOutputText;
-  reset();
-  strlcpy(m_inputText, otherInputText, sizeof(m_inputText));
-  strlcpy(m_exactOutputText, otherExactOutputText, sizeof(m_exactOutputText));
-  strlcpy(m_approximateOutputText, otherApproximateOutputText, sizeof(m_approximateOutputText));
-  return *this;
-}
-
 void Calculation::reset() {
   m_inputText[0] = 0;
   m_exactOutputText[0] = 0;
@@ -67,6 +56,15 @@ void Calculation::setContent(const char * c, Context * context, Expression * ans
   PoincareHelpers::WriteTextInBuffer(m_approximateOutput, m_approximateOutputText, sizeof(m_approximateOutputText));
 }
 
+void Calculation::setSerializedContent(const char * inputText, const char * exactOutputText, const char * approximateOutputText, KDCoordinate height, EqualSign equalSign) {
+  reset();
+  strlcpy(m_inputText, inputText, sizeof(m_inputText));
+  strlcpy(m_exactOutputText, exactOutputText, sizeof(m_exactOutputText));
+  strlcpy(m_approximateOutputText, approximateOutputText, sizeof(m_approximateOutputText));
+  m_height = height;
+  m_equalSign = equalSign;
+}
+
 KDCoordinate Calculation::height(Context * context) {
   if (m_height < 0) {
     ExpressionLayout * inputLayout = createInputLayout();
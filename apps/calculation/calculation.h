@@ -17,14 +17,19 @@ public:
   };
   Calculation();
   ~Calculation(); // Delete expression and layout, if needed
-  Calculation& operator=(const Calculation& other);
   Calculation(const Calculation& other) = delete;
+  Calculation& operator=(const Calculation& other) = delete;
   Calculation(Calculation&& other) = delete;
   Calculation& operator=(Calculation&& other) = delete;
   /* c.reset() is the equivalent of c = Calculation() without copy assingment. */
   void reset();
   void setContent(const char * c, Poincare::Context * context, Poincare::Expression * ansExpression);
+  /* setSerializedContent restores a calculation from the texts and the
+   * metrics kept by the CalculationStore, without any parsing. */
+  void setSerializedContent(const char * inputText, const char * exactOutputText, const char * approximateOutputText, KDCoordinate height, EqualSign equalSign);
   KDCoordinate height(Poincare::Context * context);
+  KDCoordinate memoizedHeight() const { return m_height; }
+  EqualSign memoizedEqualSign() const { return m_equalSign; }
   const char * inputText();
   const char * exactOutputText();
   const char * approximateOutputText();
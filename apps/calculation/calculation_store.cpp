@@ -1,91 +1,113 @@
 #include "calculation_store.h"
 #include <assert.h>
+#include <string.h>
 using namespace Poincare;
 
 namespace Calculation {
 
 CalculationStore::CalculationStore() :
-  m_startIndex(0)
+  m_buffer(),
+  m_recordOffsets(),
+  m_firstIndex(0),
+  m_numberOfCalculations(0),
+  m_cachedCalculations(),
+  m_cachedOffsets(),
+  m_nextCacheSlot(0)
 {
+  for (int i = 0; i < k_numberOfCachedCalculations; i++) {
+    m_cachedOffsets[i] = -1;
+  }
 }
 
 Calculation * CalculationStore::push(const char * text, Context * context) {
-  Calculation * result = &m_calculations[m_startIndex];
-  result->setContent(text, context, ansExpression(context));
-  m_startIndex++;
-  if (m_startIndex >= k_maxNumberOfCalculations) {
-    m_startIndex = 0;
-  }
+  /* The calculation is computed in a cache slot which does not hold Ans
+   * before being serialized, as serializing it might delete the oldest
+   * calculations. */
+  Expression * ans = ansExpression(context);
+  int ansSlot = m_numberOfCalculations > 0 ? cacheSlotOfOffset(recordOffset(m_numberOfCalculations-1)) : -1;
+  int slot = takeCacheSlot(ansSlot);
+  Calculation * result = &m_cachedCalculations[slot];
+  result->setContent(text, context, ans);
+
+  size_t inputLength = strlen(result->inputText());
+  size_t exactOutputLength = strlen(result->exactOutputText());
+  size_t approximateOutputLength = strlen(result->approximateOutputText());
+  int size = sizeof(Header) + inputLength + exactOutputLength + approximateOutputLength + 3;
+  int offset = allocateRecord(size);
+  Header header = {.size = (uint16_t)size, .height = -1, .equalSign = Calculation::EqualSign::Unknown};
+  setHeaderAtOffset(offset, header);
+  char * recordText = m_buffer + offset + sizeof(Header);
+  memcpy(recordText, result->inputText(), inputLength+1);
+  recordText += inputLength+1;
+  memcpy(recordText, result->exactOutputText(), exactOutputLength+1);
+  recordText += exactOutputLength+1;
+  memcpy(recordText, result->approximateOutputText(), approximateOutputLength+1);
+  m_recordOffsets[(m_firstIndex+m_numberOfCalculations)%k_maxNumberOfCalculations] = offset;
+  m_numberOfCalculations++;
+  m_cachedOffsets[slot] = offset;
   return result;
 }
 
 Calculation * CalculationStore::calculationAtIndex(int i) {
-  int j = 0;
-  Calculation * currentCalc = &m_calculations[m_startIndex];
-  Calculation * previousCalc = nullptr;
-  while (j <= i) {
-    if (!currentCalc++->isEmpty()) {
-      previousCalc = currentCalc - 1;
-      j++;
-    }
-    if (currentCalc >= m_calculations + k_maxNumberOfCalculations) {
-      currentCalc = m_calculations;
-    }
-  }
-  return previousCalc;
+  assert(i >= 0 && i < m_numberOfCalculations);
+  return unpackCalculationAtOffset(recordOffset(i));
 }
 
-int CalculationStore::numberOfCalculations() {
-  Calculation * currentCalc= m_calculations;
-  int numberOfCalculations = 0;
-  while (currentCalc < m_calculations + k_maxNumberOfCalculations) {
-    if (!currentCalc++->isEmpty()) {
-      numberOfCalculations++;
-    }
+KDCoordinate CalculationStore::heightOfCalculationAtIndex(int i, Context * context) {
+  assert(i >= 0 && i < m_numberOfCalculations);
+  int offset = recordOffset(i);
+  Header header = headerAtOffset(offset);
+  if (header.height < 0) {
+    /* Measuring the calculation requires its layouts: once computed, the
+     * height is kept in the record. */
+    header.height = unpackCalculationAtOffset(offset)->height(context);
+    setHeaderAtOffset(offset, header);
   }
-  return numberOfCalculations;
+  return header.height;
 }
 
 void CalculationStore::deleteCalculationAtIndex(int i) {
-  int numberOfCalc = numberOfCalculations();
-  assert(i >= 0 && i < numberOfCalc);
-  int indexFirstCalc = m_startIndex;
-  while (m_calculations[indexFirstCalc].isEmpty()) {
-    indexFirstCalc++;
-    if (indexFirstCalc == k_maxNumberOfCalculations) {
-      indexFirstCalc = 0;
-    }
-    assert(indexFirstCalc != m_startIndex);
-  }
-  int absoluteIndexCalculationI = indexFirstCalc+i;
-  absoluteIndexCalculationI = absoluteIndexCalculationI >= k_maxNumberOfCalculations ? absoluteIndexCalculationI - k_maxNumberOfCalculations : absoluteIndexCalculationI;
-
-  int index = absoluteIndexCalculationI;
-  for (int k = i; k < numberOfCalc-1; k++) {
-    int nextIndex = index+1 >= k_maxNumberOfCalculations ? 0 : index+1;
-    m_calculations[index] = m_calculations[nextIndex];
-    index++;
-    if (index == k_maxNumberOfCalculations) {
-      index = 0;
-    }
+  assert(i >= 0 && i < m_numberOfCalculations);
+  if (i == 0) {
+    deleteOldestCalculation();
+    return;
   }
-  m_calculations[index].reset();
-  m_startIndex--;
-  if (m_startIndex == -1) {
-    m_startIndex = k_maxNumberOfCalculations-1;
+  // Records are moved: the cached calculations are dropped
+  emptyCache();
+  /* Slide the next records back in the ring. A record is never moved forward
+   * in the buffer so it cannot overwrite a record that was not moved yet. */
+  int tail = endOfRecord(i-1);
+  for (int j = i+1; j < m_numberOfCalculations; j++) {
+    int offset = recordOffset(j);
+    int size = headerAtOffset(offset).size;
+    if (tail + size > k_bufferSize) {
+      tail = 0;
+    }
+    memmove(m_buffer + tail, m_buffer + offset, size);
+    m_recordOffsets[(m_firstIndex+j-1)%k_maxNumberOfCalculations] = tail;
+    tail += size;
   }
+  m_numberOfCalculations--;
 }
 
 void CalculationStore::deleteAll() {
-  m_startIndex = 0;
-  for (int i = 0; i < k_maxNumberOfCalculations; i++) {
-    m_calculations[i].reset();
-  }
+  emptyCache();
+  m_firstIndex = 0;
+  m_numberOfCalculations = 0;
 }
 
 void CalculationStore::tidy() {
-  for (int i = 0; i < k_maxNumberOfCalculations; i++) {
-    m_calculations[i].tidy();
+  /* The metrics depend on the display preferences which might change before
+   * the store is used again. */
+  for (int i = 0; i < m_numberOfCalculations; i++) {
+    int offset = recordOffset(i);
+    Header header = headerAtOffset(offset);
+    header.height = -1;
+    header.equalSign = Calculation::EqualSign::Unknown;
+    setHeaderAtOffset(offset, header);
+  }
+  for (int i = 0; i < k_numberOfCachedCalculations; i++) {
+    m_cachedCalculations[i].tidy();
   }
 }
 
@@ -109,4 +131,116 @@ Expression * CalculationStore::ansExpression(Context * context) {
   return lastCalculation->exactOutput(context);
 }
 
+int CalculationStore::recordOffset(int i) const {
+  return m_recordOffsets[(m_firstIndex+i)%k_maxNumberOfCalculations];
+}
+
+int CalculationStore::endOfRecord(int i) const {
+  int offset = recordOffset(i);
+  return offset + headerAtOffset(offset).size;
+}
+
+CalculationStore::Header CalculationStore::headerAtOffset(int offset) const {
+  // Records are not aligned
+  Header header;
+  memcpy(&header, m_buffer + offset, sizeof(Header));
+  return header;
+}
+
+void CalculationStore::setHeaderAtOffset(int offset, const Header & header) {
+  memcpy(m_buffer + offset, &header, sizeof(Header));
+}
+
+int CalculationStore::allocateRecord(int size) {
+  assert(size <= k_bufferSize);
+  if (m_numberOfCalculations == k_maxNumberOfCalculations) {
+    deleteOldestCalculation();
+  }
+  while (m_numberOfCalculations > 0) {
+    int head = recordOffset(0);
+    int tail = endOfRecord(m_numberOfCalculations-1);
+    if (tail > head) {
+      // The records lie in [head, tail[
+      if (tail + size <= k_bufferSize) {
+        return tail;
+      }
+      if (size <= head) {
+        return 0;
+      }
+    } else if (tail + size <= head) {
+      // The records lie in [head, k_bufferSize[ and [0, tail[
+      return tail;
+    }
+    deleteOldestCalculation();
+  }
+  m_firstIndex = 0;
+  return 0;
+}
+
+void CalculationStore::deleteOldestCalculation() {
+  assert(m_numberOfCalculations > 0);
+  int slot = cacheSlotOfOffset(recordOffset(0));
+  if (slot >= 0) {
+    m_cachedCalculations[slot].reset();
+    m_cachedOffsets[slot] = -1;
+  }
+  m_firstIndex = (m_firstIndex+1)%k_maxNumberOfCalculations;
+  m_numberOfCalculations--;
+}
+
+Calculation * CalculationStore::unpackCalculationAtOffset(int offset) {
+  int slot = cacheSlotOfOffset(offset);
+  if (slot >= 0) {
+    return &m_cachedCalculations[slot];
+  }
+  slot = takeCacheSlot(-1);
+  Header header = headerAtOffset(offset);
+  const char * inputText = m_buffer + offset + sizeof(Header);
+  const char * exactOutputText = inputText + strlen(inputText) + 1;
+  const char * approximateOutputText = exactOutputText + strlen(exactOutputText) + 1;
+  m_cachedCalculations[slot].setSerializedContent(inputText, exactOutputText, approximateOutputText, header.height, header.equalSign);
+  m_cachedOffsets[slot] = offset;
+  return &m_cachedCalculations[slot];
+}
+
+int CalculationStore::cacheSlotOfOffset(int offset) const {
+  for (int i = 0; i < k_numberOfCachedCalculations; i++) {
+    if (m_cachedOffsets[i] == offset) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int CalculationStore::takeCacheSlot(int excludedSlot) {
+  int slot = m_nextCacheSlot;
+  if (slot == excludedSlot) {
+    slot = (slot+1)%k_numberOfCachedCalculations;
+  }
+  m_nextCacheSlot = (slot+1)%k_numberOfCachedCalculations;
+  writeBackCacheSlot(slot);
+  m_cachedCalculations[slot].reset();
+  m_cachedOffsets[slot] = -1;
+  return slot;
+}
+
+void CalculationStore::writeBackCacheSlot(int slot) {
+  int offset = m_cachedOffsets[slot];
+  if (offset < 0) {
+    return;
+  }
+  Header header = headerAtOffset(offset);
+  header.height = m_cachedCalculations[slot].memoizedHeight();
+  header.equalSign = m_cachedCalculations[slot].memoizedEqualSign();
+  setHeaderAtOffset(offset, header);
+}
+
+void CalculationStore::emptyCache() {
+  for (int i = 0; i < k_numberOfCachedCalculations; i++) {
+    writeBackCacheSlot(i);
+    m_cachedCalculations[i].reset();
+    m_cachedOffsets[i] = -1;
+  }
+}
+
 }
@@ -5,20 +5,56 @@
 
 namespace Calculation {
 
+/* The CalculationStore keeps the history in a ring buffer of serialized
+ * calculations:
+ * | Header1 | Input1 | ExactOutput1 | ApproximateOutput1 | Header2 | ...
+ * The header holds the size of the record and the metrics measured on the
+ * calculation layouts, so that the height of a row is computed only once.
+ * The oldest calculations are removed when the buffer is full. Only a few
+ * calculations are unpacked at a time in a cache of Calculation objects: a
+ * Calculation returned by calculationAtIndex is valid until the store is
+ * modified or k_numberOfCachedCalculations other calculations are
+ * requested. */
+
 class CalculationStore {
 public:
   CalculationStore();
   Calculation * calculationAtIndex(int i);
+  KDCoordinate heightOfCalculationAtIndex(int i, Poincare::Context * context);
   Calculation * push(const char * text, Poincare::Context * context);
   void deleteCalculationAtIndex(int i);
   void deleteAll();
-  int numberOfCalculations();
+  int numberOfCalculations() const { return m_numberOfCalculations; }
   void tidy();
   Poincare::Expression * ansExpression(Poincare::Context * context);
-  static constexpr int k_maxNumberOfCalculations = 10;
+  static constexpr int k_maxNumberOfCalculations = 64;
 private:
-  int m_startIndex;
-  Calculation m_calculations[k_maxNumberOfCalculations];
+  struct Header {
+    uint16_t size;
+    KDCoordinate height;
+    Calculation::EqualSign equalSign;
+  };
+  static constexpr int k_bufferSize = 6144;
+  static constexpr int k_numberOfCachedCalculations = 3;
+  static_assert(k_bufferSize >= sizeof(Header) + 3*Calculation::k_printedExpressionSize, "The calculation buffer cannot hold the longest calculation");
+  int recordOffset(int i) const;
+  int endOfRecord(int i) const;
+  Header headerAtOffset(int offset) const;
+  void setHeaderAtOffset(int offset, const Header & header);
+  int allocateRecord(int size);
+  void deleteOldestCalculation();
+  Calculation * unpackCalculationAtOffset(int offset);
+  int cacheSlotOfOffset(int offset) const;
+  int takeCacheSlot(int excludedSlot);
+  void writeBackCacheSlot(int slot);
+  void emptyCache();
+  char m_buffer[k_bufferSize];
+  uint16_t m_recordOffsets[k_maxNumberOfCalculations];
+  int m_firstIndex;
+  int m_numberOfCalculations;
+  Calculation m_cachedCalculations[k_numberOfCachedCalculations];
+  int m_cachedOffsets[k_numberOfCachedCalculations];
+  int m_nextCacheSlot;
 };
 
 }
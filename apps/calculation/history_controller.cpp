@@ -142,9 +142,8 @@ KDCoordinate HistoryController::rowHeight(int j) {
   if (j >= m_calculationStore->numberOfCalculations()) {
     return 0;
   }
-  Calculation * calculation = m_calculationStore->calculationAtIndex(j);
   App * calculationApp = (App *)app();
-  return calculation->height(calculationApp->localContext()) + 3*HistoryViewCell::k_digitVerticalMargin;
+  return m_calculationStore->heightOfCalculationAtIndex(j, calculationApp->localContext()) + 3*HistoryViewCell::k_digitVerticalMargin;
 }
 
 int HistoryController::typeAtLocation(int i, int j) {
@@ -15,8 +15,8 @@ void assert_store_is(CalculationStore * store, const char * result[10]) {
 QUIZ_CASE(calculation_store) {
   GlobalContext globalContext;
   CalculationStore store;
-  assert(CalculationStore::k_maxNumberOfCalculations == 10);
-  for (int i = 0; i < CalculationStore::k_maxNumberOfCalculations; i++) {
+  assert(CalculationStore::k_maxNumberOfCalculations > 10);
+  for (int i = 0; i < 10; i++) {
     char text[2] = {(char)(i+'0'), 0};
     store.push(text, &globalContext);
     assert(store.numberOfCalculations() == i+1);
@@ -25,6 +25,7 @@ QUIZ_CASE(calculation_store) {
   const char * result[10] = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"};
   assert_store_is(&store, result);
 
+  store.deleteCalculationAtIndex(0);
   store.push("10", &globalContext);
   /* Store is now {1, 2, 3, 4, 5, 6, 7, 8, 9, 10} */
   const char * result1[10] = {"1", "2", "3", "4", "5", "6", "7", "8", "9", "10"};
@@ -35,17 +36,27 @@ QUIZ_CASE(calculation_store) {
   }
   /* Store is now {1, 3, 5, 7, 9} */
   const char * result2[10] = {"1", "3", "5", "7", "9", "", "", "", "", ""};
+  assert(store.numberOfCalculations() == 5);
   assert_store_is(&store, result2);
 
-  for (int i = 5; i < CalculationStore::k_maxNumberOfCalculations; i++) {
+  for (int i = 5; i < 10; i++) {
     char text[3] = {(char)(i+'0'), 0};
     store.push(text, &globalContext);
     assert(store.numberOfCalculations() == i+1);
   }
-  /* Store is now {0, 2, 4, 6, 8, 5, 6, 7, 8, 9} */
+  /* Store is now {1, 3, 5, 7, 9, 5, 6, 7, 8, 9} */
   const char * result3[10] = {"1", "3", "5", "7", "9", "5", "6", "7", "8", "9"};
   assert_store_is(&store, result3);
 
+  /* Once k_maxNumberOfCalculations is reached, the oldest calculations are
+   * removed. */
+  for (int i = 10; i < CalculationStore::k_maxNumberOfCalculations + 5; i++) {
+    store.push("1+1", &globalContext);
+  }
+  assert(store.numberOfCalculations() == CalculationStore::k_maxNumberOfCalculations);
+  assert(strcmp(store.calculationAtIndex(0)->inputText(), "5") == 0);
+  assert(strcmp(store.calculationAtIndex(5)->inputText(), "1+1") == 0);
+
   store.deleteAll();
   store.push("1+3/4", &globalContext);
   store.push("ans+2/3", &globalContext);
@@ -57,4 +68,45 @@ QUIZ_CASE(calculation_store) {
   lastCalculation = store.calculationAtIndex(2);
   assert(lastCalculation->shouldOnlyDisplayApproximateOutput(&globalContext) == true);
   assert(strcmp(lastCalculation->approximateOutputText(),"2.6366666666667") == 0);
+
+  /* Long calculations fill the ring buffer before k_maxNumberOfCalculations
+   * is reached: the oldest calculations are removed to make some room. */
+  store.deleteAll();
+  store.push("1", &globalContext);
+  char longText[101];
+  for (int i = 0; i < 100; i+= 2) {
+    longText[i] = '1';
+    longText[i+1] = '+';
+  }
+  longText[99] = 'P';
+  longText[100] = 0;
+  for (int i = 0; i < CalculationStore::k_maxNumberOfCalculations; i++) {
+    store.push(longText, &globalContext);
+    assert(strcmp(store.calculationAtIndex(store.numberOfCalculations()-1)->exactOutputText(), "49+P") == 0);
+  }
+  assert(store.numberOfCalculations() < CalculationStore::k_maxNumberOfCalculations);
+  for (int i = 0; i < store.numberOfCalculations(); i++) {
+    assert(strcmp(store.calculationAtIndex(i)->exactOutputText(), "49+P") == 0);
+  }
+  store.deleteCalculationAtIndex(1);
+  store.deleteCalculationAtIndex(store.numberOfCalculations()-1);
+  store.push("2+3", &globalContext);
+  for (int i = 0; i < store.numberOfCalculations()-1; i++) {
+    assert(strcmp(store.calculationAtIndex(i)->exactOutputText(), "49+P") == 0);
+  }
+  assert(strcmp(store.calculationAtIndex(store.numberOfCalculations()-1)->exactOutputText(), "5") == 0);
+
+  // The measured heights are kept by the store
+  store.deleteAll();
+  store.push("1/2", &globalContext);
+  store.push("3", &globalContext);
+  KDCoordinate fractionHeight = store.heightOfCalculationAtIndex(0, &globalContext);
+  KDCoordinate integerHeight = store.heightOfCalculationAtIndex(1, &globalContext);
+  assert(fractionHeight > integerHeight);
+  for (int i = 0; i < 5; i++) {
+    store.push("4", &globalContext);
+  }
+  assert(store.heightOfCalculationAtIndex(0, &globalContext) == fractionHeight);
+  store.tidy();
+  assert(store.heightOfCalculationAtIndex(0, &globalContext) == fractionHeight);
 }
@@ -10,10 +10,23 @@ namespace Graph {
 
 CartesianFunction::CartesianFunction(const char * text, KDColor color) :
   Shared::Function(text, color),
-  m_displayDerivative(false)
+  m_displayDerivative(false),
+  m_derivativeExpression(nullptr),
+  m_derivativeAngleUnit(Expression::AngleUnit::Degree)
 {
 }
 
+CartesianFunction::~CartesianFunction() {
+  tidyDerivativeExpression();
+}
+
+CartesianFunction& CartesianFunction::operator=(const CartesianFunction& other) {
+  // Self-assignment is benign
+  Shared::Function::operator=(other);
+  m_displayDerivative = other.m_displayDerivative;
+  return *this;
+}
+
 bool CartesianFunction::displayDerivative() {
   return m_displayDerivative;
 }
@@ -23,13 +36,11 @@ void CartesianFunction::setDisplayDerivative(bool display) {
 }
 
 double CartesianFunction::approximateDerivative(double x, Poincare::Context * context) const {
-  Poincare::Expression * abscissa = new Poincare::Approximation<double>(x);
-  Poincare::Expression * args[2] = {expression(context)->clone(), abscissa};
-  Poincare::Derivative derivative(args, false); // derivative takes ownership of abscissa and the clone of expression
-  /* TODO: when we will simplify derivative, we might want to simplify the
-   * derivative here. However, we might want to do it once for all x (to avoid
-   * lagging in the derivative table. */
-  return PoincareHelpers::ApproximateToScalar<double>(&derivative, *context);
+  // The reduced derivative may be defined outside the real domain of f
+  if (std::isnan(evaluateAtAbscissa(x, context))) {
+    return NAN;
+  }
+  return derivativeExpression(context)->approximateWithValueForSymbol(symbol(), x, *context, Preferences::sharedPreferences()->angleUnit());
 }
 
 double CartesianFunction::sumBetweenBounds(double start, double end, Poincare::Context * context) const {
@@ -63,4 +74,37 @@ char CartesianFunction::symbol() const {
   return 'x';
 }
 
+void CartesianFunction::setContent(const char * c) {
+  tidyDerivativeExpression();
+  Shared::Function::setContent(c);
+}
+
+void CartesianFunction::tidy() {
+  tidyDerivativeExpression();
+  Shared::Function::tidy();
+}
+
+Expression * CartesianFunction::derivativeExpression(Poincare::Context * context) const {
+  Expression::AngleUnit angleUnit = Preferences::sharedPreferences()->angleUnit();
+  if (m_derivativeExpression != nullptr && m_derivativeAngleUnit != angleUnit) {
+    delete m_derivativeExpression;
+    m_derivativeExpression = nullptr;
+  }
+  if (m_derivativeExpression == nullptr) {
+    // diff(f(x), x) is reduced to f'(x) when f can be differentiated symbolically
+    Expression * args[2] = {expression(context)->clone(), new Symbol(symbol())};
+    m_derivativeExpression = new Derivative(args, false); // derivative takes ownership of args
+    Expression::Reduce(&m_derivativeExpression, *context, angleUnit);
+    m_derivativeAngleUnit = angleUnit;
+  }
+  return m_derivativeExpression;
+}
+
+void CartesianFunction::tidyDerivativeExpression() {
+  if (m_derivativeExpression != nullptr) {
+    delete m_derivativeExpression;
+    m_derivativeExpression = nullptr;
+  }
+}
+
 }
@@ -9,6 +9,8 @@ class CartesianFunction : public Shared::Function {
 public:
   using Shared::Function::Function;
   CartesianFunction(const char * text = nullptr, KDColor color = KDColorBlack);
+  ~CartesianFunction();
+  CartesianFunction& operator=(const CartesianFunction& other);
   bool displayDerivative();
   void setDisplayDerivative(bool display);
   double approximateDerivative(double x, Poincare::Context * context) const;
@@ -18,8 +20,17 @@ public:
   double nextRootFrom(double start, double step, double max, Poincare::Context * context) const;
   Poincare::Expression::Coordinate2D nextIntersectionFrom(double start, double step, double max, Poincare::Context * context, const Shared::Function * function) const;
   char symbol() const override;
+  void setContent(const char * c) override;
+  void tidy() override;
 private:
+  /* The derivative is differentiated and reduced once for all abscissae. It
+   * falls back on numerical differentiation for functions that cannot be
+   * differentiated symbolically. */
+  Poincare::Expression * derivativeExpression(Poincare::Context * context) const;
+  void tidyDerivativeExpression();
   bool m_displayDerivative;
+  mutable Poincare::Expression * m_derivativeExpression;
+  mutable Poincare::Expression::AngleUnit m_derivativeAngleUnit;
 };
 
 }
@@ -27,18 +27,25 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
     CartesianFunction * f = m_functionStore->activeFunctionAtIndex(i);
 
     /* Draw function (color the area under curve of the selected function) */
+    EvaluateModelWithParameter evaluation = [](float t, void * model, void * context) {
+      CartesianFunction * f = (CartesianFunction *)model;
+      Poincare::Context * c = (Poincare::Context *)context;
+      return f->evaluateAtAbscissa(t, c);
+    };
+    EvaluateModelWithParameters evaluations = [](const float * t, float * y, int numberOfParameters, void * model, void * context) {
+      CartesianFunction * f = (CartesianFunction *)model;
+      Poincare::Context * c = (Poincare::Context *)context;
+      f->evaluateAtAbscissae(t, y, numberOfParameters, c);
+    };
+    EvaluateModelOverInterval enclosure = [](float tMin, float tMax, void * model, void * context) {
+      CartesianFunction * f = (CartesianFunction *)model;
+      Poincare::Context * c = (Poincare::Context *)context;
+      return f->evaluateOverInterval(tMin, tMax, c);
+    };
     if (f == m_selectedFunction) {
-      drawCurve(ctx, rect, [](float t, void * model, void * context) {
-        CartesianFunction * f = (CartesianFunction *)model;
-        Poincare::Context * c = (Poincare::Context *)context;
-        return f->evaluateAtAbscissa(t, c);
-      }, f, context(), f->color(), true, m_highlightedStart, m_highlightedEnd);
+      drawCurve(ctx, rect, evaluation, f, context(), f->color(), true, m_highlightedStart, m_highlightedEnd, false, evaluations, enclosure);
     } else {
-      drawCurve(ctx, rect, [](float t, void * model, void * context) {
-        CartesianFunction * f = (CartesianFunction *)model;
-        Poincare::Context * c = (Poincare::Context *)context;
-        return f->evaluateAtAbscissa(t, c);
-      }, f, context(), f->color());
+      drawCurve(ctx, rect, evaluation, f, context(), f->color(), false, 0.0f, 0.0f, false, evaluations, enclosure);
     }
 
     /* Draw tangent */
@@ -51,6 +51,21 @@ public:
   double evaluateAtAbscissa(double x, Poincare::Context * context) const override {
     return templatedApproximateAtAbscissa(x, static_cast<SequenceContext *>(context));
   }
+  // Terms are computed from the previous ones: they are evaluated one by one
+  void evaluateAtAbscissae(const float * x, float * y, int n, Poincare::Context * context) const override {
+    for (int i = 0; i < n; i++) {
+      y[i] = evaluateAtAbscissa(x[i], context);
+    }
+  }
+  void evaluateAtAbscissae(const double * x, double * y, int n, Poincare::Context * context) const override {
+    for (int i = 0; i < n; i++) {
+      y[i] = evaluateAtAbscissa(x[i], context);
+    }
+  }
+  // The terms of a sequence are not enclosed by its expression
+  Poincare::RealInterval evaluateOverInterval(double lower, double upper, Poincare::Context * context) const override {
+    return Poincare::RealInterval::Unbounded();
+  }
   template<typename T> T approximateToNextRank(int n, SequenceContext * sqctx) const;
   double sumBetweenBounds(double start, double end, Poincare::Context * context) const override;
   void tidy() override;
@@ -49,6 +49,9 @@ public:
   void setExpressionForSymbolName(const Poincare::Expression * expression, const Poincare::Symbol * symbol, Poincare::Context & context) override {
     m_parentContext->setExpressionForSymbolName(expression, symbol, context);
   }
+  Poincare::SimplificationCache * simplificationCache() override {
+    return m_parentContext->simplificationCache();
+  }
   template<typename T> T valueOfSequenceAtPreviousRank(int sequenceIndex, int rank) const {
     if (sizeof(T) == sizeof(float)) {
       return m_floatSequenceContext.valueOfSequenceAtPreviousRank(sequenceIndex, rank);
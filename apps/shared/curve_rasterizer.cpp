@@ -0,0 +1,181 @@
+#include "curve_rasterizer.h"
+#include <assert.h>
+#include <string.h>
+#include <cmath>
+
+namespace Shared {
+
+constexpr KDCoordinate stampSize = CurveRasterizer::k_stampSize;
+
+#if LINE_THICKNESS == 1
+
+const uint8_t stampMask[stampSize+1][stampSize+1] = {
+  {0xFF, 0xE1, 0xFF},
+  {0xE1, 0x00, 0xE1},
+  {0xFF, 0xE1, 0xFF},
+};
+
+#elif LINE_THICKNESS == 2
+
+const uint8_t stampMask[stampSize+1][stampSize+1] = {
+  {0xFF, 0xE6, 0xE6, 0xFF},
+  {0xE6, 0x33, 0x33, 0xE6},
+  {0xE6, 0x33, 0x33, 0xE6},
+  {0xFF, 0xE6, 0xE6, 0xFF},
+};
+
+#elif LINE_THICKNESS == 3
+
+const uint8_t stampMask[stampSize+1][stampSize+1] = {
+  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+  {0xFF, 0x7A, 0x0C, 0x7A, 0xFF},
+  {0xFF, 0x0C, 0x00, 0x0C, 0xFF},
+  {0xFF, 0x7A, 0x0C, 0x7A, 0xFF},
+  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF}
+};
+
+#elif LINE_THICKNESS == 5
+
+const uint8_t stampMask[stampSize+1][stampSize+1] = {
+  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+  {0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF},
+  {0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF},
+  {0xFF, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0xFF},
+  {0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF},
+  {0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF},
+  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+};
+
+#endif
+
+static inline int minInt(int x, int y) { return x < y ? x : y; }
+static inline int maxInt(int x, int y) { return x > y ? x : y; }
+
+CurveRasterizer::CurveRasterizer(KDContext * ctx, KDColor color) :
+  m_context(ctx),
+  m_color(color),
+  m_windowOrigin(KDPointZero),
+  m_isEmpty(true)
+{
+  memset(m_coverage, 0xFF, sizeof(m_coverage));
+  memset(m_spanTops, k_windowHeight, sizeof(m_spanTops));
+  memset(m_spanBottoms, 0, sizeof(m_spanBottoms));
+}
+
+CurveRasterizer::~CurveRasterizer() {
+  flush();
+}
+
+void CurveRasterizer::stamp(float pxf, float pyf) {
+  float floorX = std::floor(pxf);
+  float floorY = std::floor(pyf);
+  /* The shift ranges over [0, k_numberOfShifts]: a whole pixel shift is not
+   * the unshifted mask on the next pixel as the halo of the stamp is clipped
+   * on the other side. */
+  int horizontalShift = std::round((pxf - floorX)*k_numberOfShifts);
+  int verticalShift = std::round((pyf - floorY)*k_numberOfShifts);
+  KDCoordinate x = (KDCoordinate)floorX - (k_circleDiameter-2)/2;
+  KDCoordinate y = (KDCoordinate)floorY - (k_circleDiameter-2)/2;
+  if (!windowContains(x, y)) {
+    flush();
+    // Center the window on the stamp
+    m_windowOrigin = KDPoint(x - (k_windowWidth-stampSize)/2, y - (k_windowHeight-stampSize)/2);
+  }
+  m_isEmpty = false;
+  const uint8_t * mask = ShiftedMask(horizontalShift, verticalShift);
+  int left = x - m_windowOrigin.x();
+  int top = y - m_windowOrigin.y();
+  for (int i = 0; i < stampSize; i++) {
+    uint8_t * coverage = m_coverage + (top+i)*k_windowWidth + left;
+    for (int j = 0; j < stampSize; j++) {
+      /* Blending the color twice on a pixel leaves visible the product of
+       * both background parts: compute coverage*mask/255 with rounding. */
+      int product = coverage[j]*mask[i*stampSize+j] + 128;
+      coverage[j] = (product + (product >> 8)) >> 8;
+    }
+  }
+  for (int j = 0; j < stampSize; j++) {
+    m_spanTops[left+j] = minInt(m_spanTops[left+j], top);
+    m_spanBottoms[left+j] = maxInt(m_spanBottoms[left+j], top+stampSize-1);
+  }
+}
+
+void CurveRasterizer::flush() {
+  if (m_isEmpty) {
+    return;
+  }
+  int column = 0;
+  while (column < k_windowWidth) {
+    if (columnIsEmpty(column)) {
+      column++;
+      continue;
+    }
+    /* Gather the next columns in the same rectangle as long as less than half
+     * of the rectangle is made of untouched pixels. */
+    int firstColumn = column;
+    int top = m_spanTops[column];
+    int bottom = m_spanBottoms[column];
+    int numberOfTouchedPixels = bottom - top + 1;
+    column++;
+    while (column < k_windowWidth && !columnIsEmpty(column)) {
+      int newTop = minInt(top, m_spanTops[column]);
+      int newBottom = maxInt(bottom, m_spanBottoms[column]);
+      int newNumberOfTouchedPixels = numberOfTouchedPixels + m_spanBottoms[column] - m_spanTops[column] + 1;
+      if ((column - firstColumn + 1)*(newBottom - newTop + 1) > 2*newNumberOfTouchedPixels) {
+        break;
+      }
+      top = newTop;
+      bottom = newBottom;
+      numberOfTouchedPixels = newNumberOfTouchedPixels;
+      column++;
+    }
+    blendColumns(firstColumn, column-1, top, bottom);
+  }
+  m_isEmpty = true;
+}
+
+const uint8_t * CurveRasterizer::ShiftedMask(int horizontalShift, int verticalShift) {
+  assert(horizontalShift >= 0 && horizontalShift <= k_numberOfShifts);
+  assert(verticalShift >= 0 && verticalShift <= k_numberOfShifts);
+  static uint8_t shiftedMasks[k_numberOfShifts+1][k_numberOfShifts+1][stampSize*stampSize];
+  static bool shiftedMasksAreComputed = false;
+  if (!shiftedMasksAreComputed) {
+    for (int sx = 0; sx <= k_numberOfShifts; sx++) {
+      float dx = (float)sx/k_numberOfShifts;
+      for (int sy = 0; sy <= k_numberOfShifts; sy++) {
+        float dy = (float)sy/k_numberOfShifts;
+        for (int i = 0; i < stampSize; i++) {
+          for (int j = 0; j < stampSize; j++) {
+            shiftedMasks[sx][sy][i*stampSize+j] = dx * (stampMask[i][j]*dy+stampMask[i+1][j]*(1.0f-dy))
+              + (1.0f-dx) * (stampMask[i][j+1]*dy + stampMask[i+1][j+1]*(1.0f-dy));
+          }
+        }
+      }
+    }
+    shiftedMasksAreComputed = true;
+  }
+  return shiftedMasks[horizontalShift][verticalShift];
+}
+
+bool CurveRasterizer::windowContains(KDCoordinate x, KDCoordinate y) const {
+  return !m_isEmpty
+    && x >= m_windowOrigin.x() && x + stampSize <= m_windowOrigin.x() + k_windowWidth
+    && y >= m_windowOrigin.y() && y + stampSize <= m_windowOrigin.y() + k_windowHeight;
+}
+
+void CurveRasterizer::blendColumns(int firstColumn, int lastColumn, int top, int bottom) {
+  /* Each row of the rectangle is contiguous in the coverage buffer, which is
+   * then the mask of the row. */
+  int width = lastColumn - firstColumn + 1;
+  KDColor workingBuffer[k_windowWidth];
+  for (int row = top; row <= bottom; row++) {
+    uint8_t * coverage = m_coverage + row*k_windowWidth + firstColumn;
+    KDRect rect(m_windowOrigin.x() + firstColumn, m_windowOrigin.y() + row, width, 1);
+    m_context->blendRectWithMask(rect, m_color, coverage, workingBuffer);
+    memset(coverage, 0xFF, width);
+  }
+  memset(m_spanTops + firstColumn, k_windowHeight, width);
+  memset(m_spanBottoms + firstColumn, 0, width);
+}
+
+}
@@ -0,0 +1,62 @@
+#ifndef SHARED_CURVE_RASTERIZER_H
+#define SHARED_CURVE_RASTERIZER_H
+
+#include <kandinsky.h>
+
+namespace Shared {
+
+#define LINE_THICKNESS 2
+
+/* The CurveRasterizer draws a curve as a succession of anti-aliased stamps.
+ * The stamps are accumulated in a coverage buffer over a window of the
+ * screen, and the span of rows covered in each column of the window is kept.
+ * The window is blended on the screen when a stamp falls outside of it or
+ * when the rasterizer is flushed: neighbour columns are gathered in as few
+ * rectangles as possible, which avoids pulling and pushing the pixels around
+ * each stamp. The rectangles are blended row after row, straight from the
+ * coverage buffer: the window is the only buffer of the rasterizer, about
+ * 1.6KB on the stack of the curve being drawn. */
+
+class CurveRasterizer {
+public:
+#if LINE_THICKNESS == 1
+  constexpr static KDCoordinate k_circleDiameter = 1;
+#elif LINE_THICKNESS == 2
+  constexpr static KDCoordinate k_circleDiameter = 2;
+#elif LINE_THICKNESS == 3
+  constexpr static KDCoordinate k_circleDiameter = 3;
+#elif LINE_THICKNESS == 5
+  constexpr static KDCoordinate k_circleDiameter = 5;
+#endif
+  constexpr static KDCoordinate k_stampSize = k_circleDiameter+1;
+  CurveRasterizer(KDContext * ctx, KDColor color);
+  ~CurveRasterizer();
+  /* Stamp centered around (pxf, pyf). If pxf and pyf are not round number, the
+   * stamp is shifted (by blending adjacent pixel colors) to draw with anti
+   * aliasing. */
+  void stamp(float pxf, float pyf);
+  void flush();
+private:
+  /* The sub-pixel offsets of the stamps are rounded to 1/k_numberOfShifts of
+   * pixel to pick one of the precomputed shifted masks. */
+  constexpr static int k_numberOfShifts = 8;
+  constexpr static KDCoordinate k_windowWidth = 32;
+  constexpr static KDCoordinate k_windowHeight = 48;
+  static const uint8_t * ShiftedMask(int horizontalShift, int verticalShift);
+  bool windowContains(KDCoordinate x, KDCoordinate y) const;
+  bool columnIsEmpty(int column) const { return m_spanTops[column] > m_spanBottoms[column]; }
+  void blendColumns(int firstColumn, int lastColumn, int top, int bottom);
+  KDContext * m_context;
+  KDColor m_color;
+  KDPoint m_windowOrigin;
+  bool m_isEmpty;
+  /* The coverage is the part of the background that remains visible: 0xFF
+   * for untouched pixels and 0 for pixels fully covered by the curve. */
+  uint8_t m_coverage[k_windowWidth*k_windowHeight];
+  uint8_t m_spanTops[k_windowWidth];
+  uint8_t m_spanBottoms[k_windowWidth];
+};
+
+}
+
+#endif
@@ -290,60 +290,11 @@ void CurveView::drawAxes(KDContext * ctx, KDRect rect, Axis axis) const {
   drawLine(ctx, rect, axis, 0.0f, KDColorBlack, 1);
 }
 
-#define LINE_THICKNESS 2
-
-#if LINE_THICKNESS == 1
-
-constexpr KDCoordinate circleDiameter = 1;
-constexpr KDCoordinate stampSize = circleDiameter+1;
-const uint8_t stampMask[stampSize+1][stampSize+1] = {
-  {0xFF, 0xE1, 0xFF},
-  {0xE1, 0x00, 0xE1},
-  {0xFF, 0xE1, 0xFF},
-};
-
-#elif LINE_THICKNESS == 2
-
-constexpr KDCoordinate circleDiameter = 2;
-constexpr KDCoordinate stampSize = circleDiameter+1;
-const uint8_t stampMask[stampSize+1][stampSize+1] = {
-  {0xFF, 0xE6, 0xE6, 0xFF},
-  {0xE6, 0x33, 0x33, 0xE6},
-  {0xE6, 0x33, 0x33, 0xE6},
-  {0xFF, 0xE6, 0xE6, 0xFF},
-};
-
-#elif LINE_THICKNESS == 3
-
-constexpr KDCoordinate circleDiameter = 3;
-constexpr KDCoordinate stampSize = circleDiameter+1;
-const uint8_t stampMask[stampSize+1][stampSize+1] = {
-  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-  {0xFF, 0x7A, 0x0C, 0x7A, 0xFF},
-  {0xFF, 0x0C, 0x00, 0x0C, 0xFF},
-  {0xFF, 0x7A, 0x0C, 0x7A, 0xFF},
-  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF}
-};
-
-#elif LINE_THICKNESS == 5
-
-constexpr KDCoordinate circleDiameter = 5;
-constexpr KDCoordinate stampSize = circleDiameter+1;
-const uint8_t stampMask[stampSize+1][stampSize+1] = {
-  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-  {0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF},
-  {0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF},
-  {0xFF, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0xFF},
-  {0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF},
-  {0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF},
-  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-};
-
-#endif
-
+constexpr KDCoordinate circleDiameter = CurveRasterizer::k_circleDiameter;
+constexpr KDCoordinate stampSize = CurveRasterizer::k_stampSize;
 constexpr static int k_maxNumberOfIterations = 10;
 
-void CurveView::drawCurve(KDContext * ctx, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, KDColor color, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, bool continuously) const {
+void CurveView::drawCurve(KDContext * ctx, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, KDColor color, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, bool continuously, EvaluateModelWithParameters evaluations, EvaluateModelOverInterval enclosure) const {
   float xMin = min(Axis::Horizontal);
   float xMax = max(Axis::Horizontal);
   float xStep = (xMax-xMin)/resolution();
@@ -353,37 +304,74 @@ void CurveView::drawCurve(KDContext * ctx, KDRect rect, EvaluateModelWithParamet
   float pixelColorLowerBound = std::round(floatToPixel(Axis::Horizontal, colorLowerBound));
   float pixelColorUpperBound = std::round(floatToPixel(Axis::Horizontal, colorUpperBound));
 
-  for (float x = rectMin; x < rectMax; x += xStep) {
-    /* When |rectMin| >> xStep, rectMin + xStep = rectMin. In that case, quit
-     * the infinite loop. */
-    if (x == x-xStep || x == x+xStep) {
-      return;
-    }
-    float y = evaluation(x, model, context);
-    if (std::isnan(y)|| std::isinf(y)) {
-      continue;
-    }
-    float pxf = floatToPixel(Axis::Horizontal, x);
-    float pyf = floatToPixel(Axis::Vertical, y);
-    if (colorUnderCurve && pxf > pixelColorLowerBound && pxf < pixelColorUpperBound) {
-      KDRect colorRect((int)pxf, std::round(pyf), 1, std::round(floatToPixel(Axis::Vertical, 0.0f)) - std::round(pyf));
-      if (floatToPixel(Axis::Vertical, 0.0f) < std::round(pyf)) {
-        colorRect = KDRect((int)pxf, std::round(floatToPixel(Axis::Vertical, 0.0f)), 1, std::round(pyf) - std::round(floatToPixel(Axis::Vertical, 0.0f)));
+  /* The previous sample is kept to join dots without evaluating the model
+   * again. */
+  float previousX = NAN;
+  float previousY = NAN;
+  float xs[k_numberOfSamplesPerBatch];
+  float ys[k_numberOfSamplesPerBatch];
+  CurveRasterizer rasterizer(ctx, color);
+  float x = rectMin;
+  bool lastBatch = false;
+  while (x < rectMax && !lastBatch) {
+    int numberOfSamples = 0;
+    while (numberOfSamples < k_numberOfSamplesPerBatch && x < rectMax) {
+      /* When |rectMin| >> xStep, rectMin + xStep = rectMin. In that case, quit
+       * the infinite loop. */
+      if (x == x-xStep || x == x+xStep) {
+        lastBatch = true;
+        break;
       }
-      ctx->fillRect(colorRect, color);
+      xs[numberOfSamples++] = x;
+      x += xStep;
     }
-    stampAtLocation(ctx, rect, pxf, pyf, color);
-    if (x <= rectMin || std::isnan(evaluation(x-xStep, model, context))) {
+    if (numberOfSamples == 0) {
+      break;
+    }
+    /* The batch and its junction with the previous sample are hidden if the
+     * curve is out of rect between the previous sample and the last one, and
+     * if no area under the curve is colored. Only the last sample is then
+     * evaluated, to be joined with the next batch. */
+    float firstX = std::isnan(previousX) ? xs[0] : previousX;
+    float lastX = xs[numberOfSamples-1];
+    bool colorsBatch = colorUnderCurve && floatToPixel(Axis::Horizontal, lastX) > pixelColorLowerBound && floatToPixel(Axis::Horizontal, xs[0]) < pixelColorUpperBound;
+    if (enclosure != nullptr && !colorsBatch && valuesAreOutOfRect(enclosure(firstX, lastX, model, context), rect)) {
+      previousX = lastX;
+      previousY = evaluation(lastX, model, context);
       continue;
     }
-    if (continuously) {
-      float puf = floatToPixel(Axis::Horizontal, x - xStep);
-      float pvf = floatToPixel(Axis::Vertical, evaluation(x-xStep, model, context));
-      straightJoinDots(ctx, rect, puf, pvf, pxf, pyf, color);
-    } else {
-      jointDots(ctx, rect, evaluation, model, context, x - xStep, evaluation(x-xStep, model, context), x, y, color, k_maxNumberOfIterations);
+    evaluateAtParameters(evaluation, evaluations, xs, ys, numberOfSamples, model, context);
+    for (int i = 0; i < numberOfSamples; i++) {
+      float u = previousX;
+      float v = previousY;
+      previousX = xs[i];
+      previousY = ys[i];
+      if (std::isnan(ys[i])|| std::isinf(ys[i])) {
+        continue;
+      }
+      float pxf = floatToPixel(Axis::Horizontal, xs[i]);
+      float pyf = floatToPixel(Axis::Vertical, ys[i]);
+      if (colorUnderCurve && pxf > pixelColorLowerBound && pxf < pixelColorUpperBound) {
+        KDRect colorRect((int)pxf, std::round(pyf), 1, std::round(floatToPixel(Axis::Vertical, 0.0f)) - std::round(pyf));
+        if (floatToPixel(Axis::Vertical, 0.0f) < std::round(pyf)) {
+          colorRect = KDRect((int)pxf, std::round(floatToPixel(Axis::Vertical, 0.0f)), 1, std::round(pyf) - std::round(floatToPixel(Axis::Vertical, 0.0f)));
+        }
+        ctx->fillRect(colorRect, color);
+      }
+      stampAtLocation(&rasterizer, rect, pxf, pyf);
+      if (xs[i] <= rectMin || std::isnan(v)) {
+        continue;
+      }
+      if (continuously) {
+        float puf = floatToPixel(Axis::Horizontal, u);
+        float pvf = floatToPixel(Axis::Vertical, v);
+        straightJoinDots(&rasterizer, rect, puf, pvf, pxf, pyf);
+      } else {
+        jointDots(&rasterizer, rect, evaluation, model, context, u, v, xs[i], ys[i], k_maxNumberOfIterations);
+      }
     }
   }
+  rasterizer.flush();
 }
 
 void CurveView::drawHistogram(KDContext * ctx, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
@@ -427,6 +415,26 @@ void CurveView::drawHistogram(KDContext * ctx, KDRect rect, EvaluateModelWithPar
   }
 }
 
+bool CurveView::valuesAreOutOfRect(Poincare::RealInterval values, KDRect rect) const {
+  if (values.isUndefined()) {
+    return true;
+  }
+  // The vertical axis is upside down: the upper value is the topmost pixel
+  float topmostPixel = floatToPixel(Axis::Vertical, values.upper());
+  float bottommostPixel = floatToPixel(Axis::Vertical, values.lower());
+  return bottommostPixel < rect.top() - stampSize || topmostPixel > rect.bottom() + stampSize;
+}
+
+void CurveView::evaluateAtParameters(EvaluateModelWithParameter evaluation, EvaluateModelWithParameters evaluations, const float * t, float * y, int numberOfParameters, void * model, void * context) {
+  if (evaluations != nullptr) {
+    evaluations(t, y, numberOfParameters, model, context);
+    return;
+  }
+  for (int i = 0; i < numberOfParameters; i++) {
+    y[i] = evaluation(t[i], model, context);
+  }
+}
+
 int CurveView::numberOfLabels(Axis axis) const {
   Axis otherAxis = axis == Axis::Horizontal ? Axis::Vertical : Axis::Horizontal;
   if (min(otherAxis) > 0.0f || max(otherAxis) < 0.0f) {
@@ -435,7 +443,7 @@ int CurveView::numberOfLabels(Axis axis) const {
   return std::ceil((max(axis) - min(axis))/(2*gridUnit(axis)));
 }
 
-void CurveView::jointDots(KDContext * ctx, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, float x, float y, float u, float v, KDColor color, int maxNumberOfRecursion) const {
+void CurveView::jointDots(CurveRasterizer * rasterizer, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, float x, float y, float u, float v, int maxNumberOfRecursion) const {
   float pyf = floatToPixel(Axis::Vertical, y);
   float pvf = floatToPixel(Axis::Vertical, v);
   if (std::isnan(pyf) || std::isnan(pvf)) {
@@ -467,30 +475,30 @@ void CurveView::jointDots(KDContext * ctx, KDRect rect, EvaluateModelWithParamet
     if (std::isnan(pxf) || std::isnan(puf)) {
       return;
     }
-    straightJoinDots(ctx, rect, pxf, pyf, puf, pvf, color);
+    straightJoinDots(rasterizer, rect, pxf, pyf, puf, pvf);
     return;
   }
   float pcxf = floatToPixel(Axis::Horizontal, cx);
   float pcyf = floatToPixel(Axis::Vertical, cy);
   if (maxNumberOfRecursion > 0) {
-    stampAtLocation(ctx, rect, pcxf, pcyf, color);
-    jointDots(ctx, rect, evaluation, model, context, x, y, cx, cy, color, maxNumberOfRecursion-1);
-    jointDots(ctx, rect, evaluation, model, context, cx, cy, u, v, color, maxNumberOfRecursion-1);
+    stampAtLocation(rasterizer, rect, pcxf, pcyf);
+    jointDots(rasterizer, rect, evaluation, model, context, x, y, cx, cy, maxNumberOfRecursion-1);
+    jointDots(rasterizer, rect, evaluation, model, context, cx, cy, u, v, maxNumberOfRecursion-1);
   }
 }
 
-void CurveView::straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float pyf, float puf, float pvf, KDColor color) const {
+void CurveView::straightJoinDots(CurveRasterizer * rasterizer, KDRect rect, float pxf, float pyf, float puf, float pvf) const {
   if (pyf <= pvf) {
     for (float pnf = pyf; pnf<pvf; pnf+= 1.0f) {
       float pmf = pxf + (pnf - pyf)*(puf - pxf)/(pvf - pyf);
-      stampAtLocation(ctx, rect, pmf, pnf, color);
+      stampAtLocation(rasterizer, rect, pmf, pnf);
     }
     return;
   }
-  straightJoinDots(ctx, rect, puf, pvf, pxf, pyf, color);
+  straightJoinDots(rasterizer, rect, puf, pvf, pxf, pyf);
 }
 
-void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color) const {
+void CurveView::stampAtLocation(CurveRasterizer * rasterizer, KDRect rect, float pxf, float pyf) const {
   // We avoid drawing when no part of the stamp is visible
   if (pyf < -stampSize || pyf > pixelLength(Axis::Vertical)+stampSize) {
     return;
@@ -501,20 +509,7 @@ void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float p
   if (!rect.intersects(stampRect)) {
     return;
   }
-  uint8_t shiftedMask[stampSize][stampSize];
-  KDColor workingBuffer[stampSize*stampSize];
-  float dx = pxf - std::floor(pxf);
-  float dy = pyf - std::floor(pyf);
-  /* TODO: this could be optimized by precomputing 10 or 100 shifted masks. The
-   * dx and dy would be rounded to one tenth or one hundredth to choose the
-   * right shifted mask. */
-  for (int i=0; i<stampSize; i++) {
-    for (int j=0; j<stampSize; j++) {
-      shiftedMask[i][j] = dx * (stampMask[i][j]*dy+stampMask[i+1][j]*(1.0f-dy))
-        + (1.0f-dx) * (stampMask[i][j+1]*dy + stampMask[i+1][j+1]*(1.0f-dy));
-    }
-  }
-  ctx->blendRectWithMask(stampRect, color, (const uint8_t *)shiftedMask, workingBuffer);
+  rasterizer->stamp(pxf, pyf);
 }
 
 void CurveView::layoutSubviews() {
@@ -7,12 +7,15 @@
 #include "curve_view_range.h"
 #include "curve_view_cursor.h"
 #include "banner_view.h"
+#include "curve_rasterizer.h"
 
 namespace Shared {
 
 class CurveView : public View {
 public:
   typedef float (*EvaluateModelWithParameter)(float t, void * model, void * context);
+  typedef void (*EvaluateModelWithParameters)(const float * t, float * y, int numberOfParameters, void * model, void * context);
+  typedef Poincare::RealInterval (*EvaluateModelOverInterval)(float tMin, float tMax, void * model, void * context);
   enum class Axis {
     Horizontal = 0,
     Vertical = 1
@@ -56,7 +59,11 @@ protected:
   void drawGridLines(KDContext * ctx, KDRect rect, Axis axis, float step, KDColor color) const;
   void drawGrid(KDContext * ctx, KDRect rect) const;
   void drawAxes(KDContext * ctx, KDRect rect, Axis axis) const;
-  void drawCurve(KDContext * ctx, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, KDColor color, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, bool continuously = false) const;
+  /* The curve is sampled by batches. When given, the evaluations method
+   * computes a whole batch at once; otherwise, evaluation is called on each
+   * parameter. When given, the enclosure method bounds the values of the curve
+   * over a batch: batches whose values are all out of rect are not sampled. */
+  void drawCurve(KDContext * ctx, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, KDColor color, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, bool continuously = false, EvaluateModelWithParameters evaluations = nullptr, EvaluateModelOverInterval enclosure = nullptr) const;
   void drawHistogram(KDContext * ctx, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
     bool fillBar, KDColor defaultColor, KDColor highlightColor,  float highlightLowerBound = INFINITY, float highlightUpperBound = -INFINITY) const;
   void computeLabels(Axis axis);
@@ -72,15 +79,17 @@ private:
   KDCoordinate pixelLength(Axis axis) const;
   virtual char * label(Axis axis, int index) const = 0;
   int numberOfLabels(Axis axis) const;
+  constexpr static int k_numberOfSamplesPerBatch = 32;
+  // Returns true if no stamp centered on one of the values is visible in rect
+  bool valuesAreOutOfRect(Poincare::RealInterval values, KDRect rect) const;
+  static void evaluateAtParameters(EvaluateModelWithParameter evaluation, EvaluateModelWithParameters evaluations, const float * t, float * y, int numberOfParameters, void * model, void * context);
   /* Recursively join two dots (dichotomy). The method stops when the
    * maxNumberOfRecursion in reached. */
-  void jointDots(KDContext * ctx, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, float x, float y, float u, float v, KDColor color, int maxNumberOfRecursion) const;
+  void jointDots(CurveRasterizer * rasterizer, KDRect rect, EvaluateModelWithParameter evaluation, void * model, void * context, float x, float y, float u, float v, int maxNumberOfRecursion) const;
   /* Join two dots with a straight line. */
-  void straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float pyf, float puf, float pvf, KDColor color) const;
-  /* Stamp centered around (pxf, pyf). If pxf and pyf are not round number, the
-   * function shifts the stamp (by blending adjacent pixel colors) to draw with
-   * anti alising. */
-  void stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color) const;
+  void straightJoinDots(CurveRasterizer * rasterizer, KDRect rect, float pxf, float pyf, float puf, float pvf) const;
+  // Stamp centered around (pxf, pyf) if it is visible in rect
+  void stampAtLocation(CurveRasterizer * rasterizer, KDRect rect, float pxf, float pyf) const;
   void layoutSubviews() override;
   KDRect cursorFrame();
   KDRect bannerFrame();
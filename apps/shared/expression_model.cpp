@@ -22,10 +22,7 @@ ExpressionModel::~ExpressionModel() {
     delete m_layout;
     m_layout = nullptr;
   }
-  if (m_expression != nullptr) {
-    delete m_expression;
-    m_expression = nullptr;
-  }
+  tidyExpression();
 }
 
 ExpressionModel& ExpressionModel::operator=(const ExpressionModel& other) {
@@ -45,6 +42,17 @@ Poincare::Expression * ExpressionModel::expression(Poincare::Context * context)
   return m_expression;
 }
 
+template<typename T>
+const Poincare::ApproximationProgram<T> & ExpressionModel::approximationProgram(char symbol, Poincare::Context * context) const {
+  ApproximationProgram<T> & program = approximationProgram(T());
+  Expression * e = expression(context);
+  Expression::AngleUnit angleUnit = Preferences::sharedPreferences()->angleUnit();
+  if (program.expression() != e || program.angleUnit() != angleUnit) {
+    program.compile(e, symbol, *context, angleUnit);
+  }
+  return program;
+}
+
 Poincare::ExpressionLayout * ExpressionModel::layout() {
   if (m_layout == nullptr) {
     Expression * nonSimplifiedExpression = Expression::parse(m_text);
@@ -73,10 +81,7 @@ void ExpressionModel::setContent(const char * c) {
     delete m_layout;
     m_layout = nullptr;
   }
-  if (m_expression != nullptr) {
-    delete m_expression;
-    m_expression = nullptr;
-  }
+  tidyExpression();
 }
 
 void ExpressionModel::tidy() {
@@ -84,6 +89,15 @@ void ExpressionModel::tidy() {
     delete m_layout;
     m_layout = nullptr;
   }
+  tidyExpression();
+}
+
+void ExpressionModel::tidyExpression() {
+  /* The approximation programs point to m_expression: they are reset with it
+   * so that they are not mistaken for the ones of a new expression allocated
+   * at the same address. */
+  m_floatApproximationProgram.reset();
+  m_doubleApproximationProgram.reset();
   if (m_expression != nullptr) {
     delete m_expression;
     m_expression = nullptr;
@@ -91,3 +105,6 @@ void ExpressionModel::tidy() {
 }
 
 }
+
+template const Poincare::ApproximationProgram<float> & Shared::ExpressionModel::approximationProgram<float>(char, Poincare::Context *) const;
+template const Poincare::ApproximationProgram<double> & Shared::ExpressionModel::approximationProgram<double>(char, Poincare::Context *) const;
@@ -17,6 +17,9 @@ public:
   ExpressionModel(ExpressionModel&& other) = delete;
   const char * text() const;
   Poincare::Expression * expression(Poincare::Context * context) const;
+  /* The approximation program of the expression is compiled on first use and
+   * kept as long as the expression. */
+  template<typename T> const Poincare::ApproximationProgram<T> & approximationProgram(char symbol, Poincare::Context * context) const;
   Poincare::ExpressionLayout * layout();
   /* Here, isDefined is the exact contrary of isEmpty. However, for Sequence
    * inheriting from ExpressionModel, isEmpty and isDefined have not exactly
@@ -33,9 +36,14 @@ public:
 private:
   constexpr static size_t k_dataLengthInBytes = (TextField::maxBufferSize())*sizeof(char);
   static_assert((k_dataLengthInBytes & 0x3) == 0, "The expression model data size is not a multiple of 4 bytes (cannot compute crc)"); // Assert that dataLengthInBytes is a multiple of 4
+  Poincare::ApproximationProgram<float> & approximationProgram(float precision) const { return m_floatApproximationProgram; }
+  Poincare::ApproximationProgram<double> & approximationProgram(double precision) const { return m_doubleApproximationProgram; }
+  void tidyExpression();
   char m_text[k_expressionBufferSize];
   mutable Poincare::Expression * m_expression;
   mutable Poincare::ExpressionLayout * m_layout;
+  mutable Poincare::ApproximationProgram<float> m_floatApproximationProgram;
+  mutable Poincare::ApproximationProgram<double> m_doubleApproximationProgram;
 };
 
 }
@@ -39,12 +39,23 @@ void Function::setActive(bool active) {
   m_active = active;
 }
 
+RealInterval Function::evaluateOverInterval(double lower, double upper, Poincare::Context * context) const {
+  return expression(context)->approximateIntervalForSymbol(symbol(), lower, upper, *context, Preferences::sharedPreferences()->angleUnit());
+}
+
 template<typename T>
 T Function::templatedApproximateAtAbscissa(T x, Poincare::Context * context) const {
-  return expression(context)->approximateWithValueForSymbol(symbol(), x, *context, Preferences::sharedPreferences()->angleUnit());
+  return approximationProgram<T>(symbol(), context).approximateWithValueForSymbol(x, *context);
+}
+
+template<typename T>
+void Function::templatedApproximateAtAbscissae(const T * x, T * y, int n, Poincare::Context * context) const {
+  approximationProgram<T>(symbol(), context).approximateWithValuesForSymbol(x, y, n, *context);
 }
 
 }
 
 template float Shared::Function::templatedApproximateAtAbscissa<float>(float, Poincare::Context*) const;
 template double Shared::Function::templatedApproximateAtAbscissa<double>(double, Poincare::Context*) const;
+template void Shared::Function::templatedApproximateAtAbscissae<float>(const float *, float *, int, Poincare::Context*) const;
+template void Shared::Function::templatedApproximateAtAbscissae<double>(const double *, double *, int, Poincare::Context*) const;
@@ -20,11 +20,21 @@ public:
   virtual double evaluateAtAbscissa(double x, Poincare::Context * context) const {
     return templatedApproximateAtAbscissa(x, context);
   }
+  // Evaluate the function at n abscissae at once
+  virtual void evaluateAtAbscissae(const float * x, float * y, int n, Poincare::Context * context) const {
+    templatedApproximateAtAbscissae(x, y, n, context);
+  }
+  virtual void evaluateAtAbscissae(const double * x, double * y, int n, Poincare::Context * context) const {
+    templatedApproximateAtAbscissae(x, y, n, context);
+  }
+  // Enclosure of the values of the function when x ranges over [lower, upper]
+  virtual Poincare::RealInterval evaluateOverInterval(double lower, double upper, Poincare::Context * context) const;
   virtual double sumBetweenBounds(double start, double end, Poincare::Context * context) const = 0;
 private:
   constexpr static size_t k_dataLengthInBytes = (TextField::maxBufferSize()+2)*sizeof(char)+2;
   static_assert((k_dataLengthInBytes & 0x3) == 0, "The function data size is not a multiple of 4 bytes (cannot compute crc)"); // Assert that dataLengthInBytes is a multiple of 4
   template<typename T> T templatedApproximateAtAbscissa(T x, Poincare::Context * context) const;
+  template<typename T> void templatedApproximateAtAbscissae(const T * x, T * y, int n, Poincare::Context * context) const;
   virtual char symbol() const = 0;
   const char * m_name;
   KDColor m_color;
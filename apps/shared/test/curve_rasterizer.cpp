@@ -0,0 +1,104 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+#include "../curve_rasterizer.h"
+
+using namespace Shared;
+
+constexpr KDCoordinate k_width = 40;
+constexpr KDCoordinate k_height = 40;
+
+// A frame buffer context counting the pixels that are drawn
+class CountingFrameBufferContext : public KDFrameBufferContext {
+public:
+  CountingFrameBufferContext(KDFrameBuffer * frameBuffer) :
+    KDFrameBufferContext(frameBuffer),
+    m_numberOfDrawnPixels(0)
+  {
+  }
+  int numberOfDrawnPixels() const { return m_numberOfDrawnPixels; }
+  void resetCounters() { m_numberOfDrawnPixels = 0; }
+private:
+  void pushRect(KDRect rect, const KDColor * pixels) override {
+    m_numberOfDrawnPixels += rect.width()*rect.height();
+    KDFrameBufferContext::pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_numberOfDrawnPixels += rect.width()*rect.height();
+    KDFrameBufferContext::pushRectUniform(rect, color);
+  }
+  int m_numberOfDrawnPixels;
+};
+
+static KDColor background(int x, int y) {
+  return KDColor::RGB16((x+y*k_width)*37);
+}
+
+/* The part of the background left visible by a stamp of thickness 2 drawn on
+ * a whole pixel, from its top left pixel. */
+static_assert(CurveRasterizer::k_stampSize == 3, "The expected stamp is 3x3");
+constexpr uint8_t k_stampMask[3][3] = {
+  {0x33, 0x33, 0xE6},
+  {0x33, 0x33, 0xE6},
+  {0xE6, 0xE6, 0xFF}
+};
+
+static uint8_t visible_background(KDPoint p, const KDPoint * stamps, int numberOfStamps) {
+  int visible = 0xFF;
+  for (int k = 0; k < numberOfStamps; k++) {
+    int i = p.y() - stamps[k].y();
+    int j = p.x() - stamps[k].x();
+    if (i >= 0 && i < 3 && j >= 0 && j < 3) {
+      int product = visible*k_stampMask[i][j] + 128;
+      visible = (product + (product >> 8)) >> 8;
+    }
+  }
+  return visible;
+}
+
+static void assert_stamps_are_drawn(const KDPoint * stamps, int numberOfStamps, int numberOfBlendedPixels) {
+  static KDColor pixels[k_width*k_height];
+  static KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  static CountingFrameBufferContext context(&frameBuffer);
+  for (int y = 0; y < k_height; y++) {
+    for (int x = 0; x < k_width; x++) {
+      pixels[x+y*k_width] = background(x, y);
+    }
+  }
+  context.resetCounters();
+  {
+    CurveRasterizer rasterizer(&context, KDColorRed);
+    for (int k = 0; k < numberOfStamps; k++) {
+      rasterizer.stamp(stamps[k].x(), stamps[k].y());
+    }
+  }
+  for (int y = 0; y < k_height; y++) {
+    for (int x = 0; x < k_width; x++) {
+      uint8_t visible = visible_background(KDPoint(x, y), stamps, numberOfStamps);
+      KDColor expected = visible == 0xFF ? background(x, y) : KDColor::blend(background(x, y), KDColorRed, visible);
+      assert(pixels[x+y*k_width] == expected);
+    }
+  }
+  // Only the spans of rows touched in each column are blended
+  assert(context.numberOfDrawnPixels() == numberOfBlendedPixels);
+}
+
+QUIZ_CASE(curve_rasterizer_stamp) {
+  KDPoint stamp(10, 20);
+  assert_stamps_are_drawn(&stamp, 1, 3*3);
+  // Overlapping stamps multiply the visible parts of the background
+  KDPoint overlappingStamps[] = {KDPoint(10, 20), KDPoint(10, 20), KDPoint(11, 21)};
+  assert_stamps_are_drawn(overlappingStamps, 3, 4*4);
+}
+
+QUIZ_CASE(curve_rasterizer_spans) {
+  // Distant columns of a window are blended in separate rectangles
+  KDPoint stamps[] = {KDPoint(5, 5), KDPoint(12, 25)};
+  assert_stamps_are_drawn(stamps, 2, 2*3*3);
+  // A staircase is blended as a single rectangle as long as half is touched
+  KDPoint staircase[] = {KDPoint(5, 5), KDPoint(6, 6), KDPoint(7, 7)};
+  assert_stamps_are_drawn(staircase, 3, 5*5);
+  // A stamp outside of the window flushes it
+  KDPoint farStamps[] = {KDPoint(1, 1), KDPoint(36, 36)};
+  assert_stamps_are_drawn(farStamps, 2, 2*3*3);
+}
@@ -149,6 +149,11 @@ QUIZ_CASE(equation_solve) {
 
   double solutions17[] = {0};
   assert_equation_approximate_solve_to("R(y)=0", -900.0, 1000.0, 'y', solutions17, 1, false);
+
+  // Linear system of 5 equations
+  const char * equations18[] = {"x+y+z+t+w=5/2", "2x-y+3z-t+w/2=5/2", "x/3+y+4t-w=31/3", "5x-2z+t+7w=7", "-x+3y+z/2+2w=-27/4", 0};
+  const char * solutions18[] = {"3", "0", "1", "-2", "(1)/(2)"};
+  assert_equation_system_exact_solve_to(equations18,  EquationStore::Error::NoError, EquationStore::Type::LinearSystem, "twxyz", solutions18, 5);
 }
 
 }
@@ -7,6 +7,12 @@
 /stack_start/ { stack_start = $1 }
 /stack_end/ { stack_end = $1 }
 
+# With -fdata-sections, each font bitmap has its own section, whose address and
+# size are on the line of its name or on the next one if the name is too long.
+/^ \.rodata\.bitmap[A-Za-z]*Font$/ { font_size_on_next_line = 1; next }
+/^ \.rodata\.bitmap[A-Za-z]*Font / { fonts_size += $3 }
+font_size_on_next_line { fonts_size += $2; font_size_on_next_line = 0 }
+
 function log_section(name, start, end) {
   printf("%s: 0x%x - 0x%x (0x%x = %d = %dK)\n", name, start, end, end-start, end-start, (end-start)/1024)
 }
@@ -16,4 +22,8 @@ END {
   log_section("BSS  ", bss_start, bss_end);
   log_section("HEAP ", heap_start, heap_end);
   log_section("STACK", stack_end, stack_start);
+  if (font_bits_per_pixel > 0) {
+    saved = fonts_size*8/font_bits_per_pixel - fonts_size;
+    printf("FONTS: 0x%x = %d = %dK at %d bits per pixel, saving %d = %dK of flash\n", fonts_size, fonts_size, fonts_size/1024, font_bits_per_pixel, saved, saved/1024)
+  }
 }
@@ -28,7 +28,7 @@ products += $(patsubst %.$(EXE),%.map,$(filter %.$(EXE),$(products)))
 .PHONY: %_memory_map
 %_memory_map: %.map
 	@echo "========== MEMORY MAP ========="
-	$(Q) awk -f build/device/memory_map.awk < $<
+	$(Q) awk -v font_bits_per_pixel=$(KANDINSKY_FONT_BITS_PER_PIXEL) -f build/device/memory_map.awk < $<
 	@echo "==============================="
 
 .PHONY: %_flash
@@ -76,6 +76,9 @@ private:
   };
   ContentView m_contentView;
   ExpressionLayoutFieldDelegate * m_delegate;
+  /* The layouts are invalidated as they are edited: the height of the field
+   * before the edition is kept to notify the delegate of a size change. */
+  KDCoordinate m_previousHeight;
 };
 
 #endif
@@ -71,6 +71,8 @@ private:
   virtual void layoutSubviews();
   virtual const Window * window() const;
   KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  void addAbsoluteDirtyRectsToRegion(KDRegion * region);
+  void clearDirtyRects();
   KDPoint absoluteOrigin() const;
   KDRect absoluteVisibleFrame() const;
 
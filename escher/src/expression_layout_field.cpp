@@ -11,8 +11,10 @@
 ExpressionLayoutField::ExpressionLayoutField(Responder * parentResponder, Poincare::ExpressionLayout * expressionLayout, ExpressionLayoutFieldDelegate * delegate) :
   ScrollableView(parentResponder, &m_contentView, this),
   m_contentView(expressionLayout),
-  m_delegate(delegate)
+  m_delegate(delegate),
+  m_previousHeight(0)
 {
+  m_previousHeight = minimalSizeForOptimalDisplay().height();
 }
 
 bool ExpressionLayoutField::isEditing() const {
@@ -159,10 +161,10 @@ bool ExpressionLayoutField::privateHandleEvent(Ion::Events::Event event) {
 }
 
 void ExpressionLayoutField::reload() {
-  KDSize previousSize = minimalSizeForOptimalDisplay();
-  expressionLayout()->invalidAllSizesPositionsAndBaselines();
-  KDSize newSize = minimalSizeForOptimalDisplay();
-  if (m_delegate && previousSize.height() != newSize.height()) {
+  KDCoordinate newHeight = minimalSizeForOptimalDisplay().height();
+  bool heightChanged = newHeight != m_previousHeight;
+  m_previousHeight = newHeight;
+  if (m_delegate && heightChanged) {
     m_delegate->expressionLayoutFieldDidChangeSize(this);
   }
   m_contentView.cursorPositionChanged();
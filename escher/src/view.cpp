@@ -70,10 +70,15 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     KDPoint absOrigin = absoluteOrigin();
     KDRect absRect = rectNeedingRedraw.translatedBy(absOrigin);
     KDRect absClippingRect = absoluteVisibleFrame().intersectedWith(absRect);
-    KDContext * ctx = KDIonContext::sharedContext();
+    KDContext * ctx = KDTileContext::sharedContext();
     ctx->setOrigin(absOrigin);
     ctx->setClippingRect(absClippingRect);
     this->drawRect(ctx, rectNeedingRedraw);
+    /* Drawing directly on the display, as MicroPython's kandinsky module does,
+     * happens in the frame of the last view drawn. */
+    KDContext * ionCtx = KDIonContext::sharedContext();
+    ionCtx->setOrigin(absOrigin);
+    ionCtx->setClippingRect(absoluteVisibleFrame());
   }
   // This initializes the area that has been redrawn.
   KDRect redrawnArea = rectNeedingRedraw;
@@ -101,13 +106,38 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     // We expand the redrawn area to include the area just drawn.
     redrawnArea = redrawnArea.unionedWith(subviewRedrawnArea.translatedBy(subview->m_frame.origin()));
   }
-  // Eventually, mark that we don't need to be redrawn
-  m_dirtyRect = KDRectZero;
+  /* The dirty rect is not reset here: the window redraws its hierarchy tile by
+   * tile and clears the dirty rects once the last tile has been drawn. */
 
   // The function returns the total area that have been redrawn.
   return redrawnArea;
 }
 
+void View::addAbsoluteDirtyRectsToRegion(KDRegion * region) {
+  /* The rects forced to be redrawn in a view are drawn by its ancestors or its
+   * previous sisters, so the dirty rects of the hierarchy cover the area
+   * redrawn by View::redraw. */
+  region->addRect(m_dirtyRect
+    .translatedBy(absoluteOrigin())
+    .intersectedWith(absoluteVisibleFrame()));
+  for (uint8_t i=0; i<numberOfSubviews(); i++) {
+    View * subview = this->subview(i);
+    if (subview != nullptr) {
+      subview->addAbsoluteDirtyRectsToRegion(region);
+    }
+  }
+}
+
+void View::clearDirtyRects() {
+  m_dirtyRect = KDRectZero;
+  for (uint8_t i=0; i<numberOfSubviews(); i++) {
+    View * subview = this->subview(i);
+    if (subview != nullptr) {
+      subview->clearDirtyRects();
+    }
+  }
+}
+
 View * View::subview(int index) {
   assert(index >= 0 && index < numberOfSubviews());
   View * subview = subviewAtIndex(index);
@@ -14,7 +14,27 @@ void Window::redraw(bool force) {
     markRectAsDirty(bounds());
   }
   Ion::Display::waitForVBlank();
-  View::redraw(bounds());
+  /* The dirty area is drawn in RAM, tile after tile, so that each pixel is
+   * pushed once to the display however many views draw it. The dirty rects of
+   * the hierarchy are gathered into a few disjoint rects, and each of them is
+   * redrawn in horizontal bands as wide as itself. */
+  KDRegion dirtyRegion;
+  addAbsoluteDirtyRectsToRegion(&dirtyRegion);
+  KDTileContext * ctx = KDTileContext::sharedContext();
+  for (int i = 0; i < dirtyRegion.numberOfRects(); i++) {
+    KDRect dirtyRect = dirtyRegion.rectAtIndex(i);
+    KDCoordinate tileHeight = KDTileContext::k_bufferSize/dirtyRect.width();
+    KDCoordinate top = dirtyRect.top();
+    while (top <= dirtyRect.bottom()) {
+      KDCoordinate height = dirtyRect.bottom() - top + 1;
+      KDRect tile(dirtyRect.left(), top, dirtyRect.width(), height < tileHeight ? height : tileHeight);
+      ctx->setTile(tile);
+      View::redraw(tile.translatedBy(absoluteOrigin().opposite()));
+      ctx->flush();
+      top += tile.height();
+    }
+  }
+  clearDirtyRects();
 }
 
 void Window::setContentView(View * contentView) {
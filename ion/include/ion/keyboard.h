@@ -55,6 +55,12 @@ private:
 
 State scan();
 
+/* cachedScan returns a scan at most k_cachedScanLifetime milliseconds old. A
+ * full scan of the keyboard is slow, which matters when interruptions are
+ * polled from tight loops (simplification, Python bytecodes...). */
+constexpr int k_cachedScanLifetime = 20;
+State cachedScan();
+
 static_assert(sizeof(State)*8>NumberOfKeys, "Ion::Keyboard::State cannot hold a keyboard snapshot");
 
 
@@ -0,0 +1,16 @@
+#ifndef ION_TIMING_H
+#define ION_TIMING_H
+
+#include <stdint.h>
+
+namespace Ion {
+namespace Timing {
+
+/* Number of milliseconds elapsed since boot. The device clock does not tick
+ * while the calculator is suspended. */
+uint64_t millis();
+
+}
+}
+
+#endif
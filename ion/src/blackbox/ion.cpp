@@ -1,5 +1,12 @@
 #include <stdint.h>
 #include <ion.h>
+#include <chrono>
 
 void Ion::msleep(long ms) {
 }
+
+uint64_t Ion::Timing::millis() {
+  static auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
@@ -3,5 +3,6 @@
 
 void start();
 void abort();
+void isr_systick();
 
 #endif
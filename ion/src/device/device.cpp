@@ -12,6 +12,7 @@ extern "C" {
 #include "backlight.h"
 #include "console.h"
 #include "swd.h"
+#include "timing.h"
 #include "usb.h"
 #include "bench/bench.h"
 #include "base64.h"
@@ -167,9 +168,11 @@ void initPeripherals() {
 #endif
   Console::Device::init();
   SWD::Device::init();
+  Timing::Device::init();
 }
 
 void shutdownPeripherals(bool keepLEDAwake) {
+  Timing::Device::shutdown();
   SWD::Device::shutdown();
   Console::Device::shutdown();
 #if USE_SD_CARD
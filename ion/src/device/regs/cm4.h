@@ -5,6 +5,28 @@
 
 class CM4 {
 public:
+  // SysTick Control and Status Register
+  class SYST_CSR : public Register32 {
+  public:
+    using Register32::Register32;
+    enum class CLKSOURCE : uint8_t {
+      AHB_DIV8 = 0,
+      AHB = 1
+    };
+    REGS_BOOL_FIELD(ENABLE, 0);
+    REGS_BOOL_FIELD(TICKINT, 1);
+    REGS_TYPE_FIELD(CLKSOURCE, 2, 2);
+    REGS_BOOL_FIELD(COUNTFLAG, 16);
+  };
+
+  // SysTick Reload Value Register, only the 24 lowest bits are used
+  class SYST_RVR : public Register32 {
+  };
+
+  // SysTick Current Value Register
+  class SYST_CVR : public Register32 {
+  };
+
   // Vector table offset register
   // http://www.st.com/content/ccc/resource/technical/document/programming_manual/6c/3a/cb/e7/e4/ea/44/9b/DM00046982.pdf/files/DM00046982.pdf/jcr:content/translations/en.DM00046982.pdf
   class VTOR : Register32 {
@@ -41,13 +63,16 @@ public:
   };
 
   constexpr CM4() {};
-  REGS_REGISTER_AT(VTOR, 0x08);
-  REGS_REGISTER_AT(AIRCR, 0x0C);
-  REGS_REGISTER_AT(SCR, 0x10);
-  REGS_REGISTER_AT(CPACR, 0x88);
+  REGS_REGISTER_AT(SYST_CSR, 0x10);
+  REGS_REGISTER_AT(SYST_RVR, 0x14);
+  REGS_REGISTER_AT(SYST_CVR, 0x18);
+  REGS_REGISTER_AT(VTOR, 0xD08);
+  REGS_REGISTER_AT(AIRCR, 0xD0C);
+  REGS_REGISTER_AT(SCR, 0xD10);
+  REGS_REGISTER_AT(CPACR, 0xD88);
 private:
   constexpr uint32_t Base() const {
-    return 0xE000ED00;
+    return 0xE000E000;
   }
 };
 
@@ -0,0 +1,46 @@
+#include <ion/timing.h>
+#include "timing.h"
+#include "regs/regs.h"
+extern "C" {
+#include "boot/rt0.h"
+}
+
+static volatile uint64_t sMillis = 0;
+
+void isr_systick() {
+  sMillis = sMillis + 1;
+}
+
+uint64_t Ion::Timing::millis() {
+  /* The 64-bit counter is loaded in two 32-bit words, between which the
+   * SysTick interrupt may increment it: read it until two reads agree. */
+  uint64_t millis;
+  do {
+    millis = sMillis;
+  } while (millis != sMillis);
+  return millis;
+}
+
+namespace Ion {
+namespace Timing {
+namespace Device {
+
+void init() {
+  /* The SysTick counter is clocked at AHB/8 = 12 MHz. Reloading it every 12000
+   * ticks triggers an interrupt each millisecond. */
+  CM4.SYST_RVR()->set(12000-1);
+  CM4.SYST_CVR()->set(0);
+  class CM4::SYST_CSR syst_csr(0); // Reset value
+  syst_csr.setCLKSOURCE(CM4::SYST_CSR::CLKSOURCE::AHB_DIV8);
+  syst_csr.setTICKINT(true);
+  syst_csr.setENABLE(true);
+  CM4.SYST_CSR()->set(syst_csr);
+}
+
+void shutdown() {
+  CM4.SYST_CSR()->setENABLE(false);
+}
+
+}
+}
+}
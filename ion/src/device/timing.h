@@ -0,0 +1,18 @@
+#ifndef ION_DEVICE_TIMING_H
+#define ION_DEVICE_TIMING_H
+
+namespace Ion {
+namespace Timing {
+namespace Device {
+
+/* The SysTick timer fires an interrupt every millisecond, which increments the
+ * counter returned by Ion::Timing::millis. */
+
+void init();
+void shutdown();
+
+}
+}
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include <ion/usb.h>
 #include <string.h>
 #include <assert.h>
+#include "../timing.h"
 
 extern char _stack_end;
 extern char _dfu_bootloader_flash_start;
@@ -61,8 +62,14 @@ void DFU() {
    *        add-symbol-file ion/src/device/usb/dfu.elf 0x20038000
    */
 
+  /* The SysTick interrupt handler lives in Flash, which might be rewritten by
+   * the DFU transfer: disable it in the meantime. */
+  Timing::Device::shutdown();
+
   dfu_bootloader_entry(true);
 
+  Timing::Device::init();
+
   /* 5- That's all. The DFU bootloader on the stack is now dead code that will
    * be overwritten when the stack grows. */
 }
@@ -1,4 +1,5 @@
 #include <ion.h>
+#include <emscripten.h>
 #include "display.h"
 #include "events_keyboard.h"
 #include "../../../apps/global_preferences.h"
@@ -21,3 +22,7 @@ int main(int argc, char * argv[]) {
 
 void Ion::msleep(long ms) {
 }
+
+uint64_t Ion::Timing::millis() {
+  return emscripten_get_now();
+}
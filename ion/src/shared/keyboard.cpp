@@ -0,0 +1,21 @@
+#include <ion/keyboard.h>
+#include <ion/timing.h>
+
+namespace Ion {
+namespace Keyboard {
+
+State cachedScan() {
+  static State sState(0);
+  static uint64_t sScanTime = 0;
+  static bool sHasScanned = false;
+  uint64_t now = Timing::millis();
+  if (!sHasScanned || now - sScanTime >= k_cachedScanLifetime) {
+    sState = scan();
+    sScanTime = now;
+    sHasScanned = true;
+  }
+  return sState;
+}
+
+}
+}
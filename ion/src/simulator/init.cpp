@@ -116,3 +116,9 @@ void Ion::msleep(long ms) {
     }
   }
 }
+
+uint64_t Ion::Timing::millis() {
+  static auto start = std::chrono::high_resolution_clock::now();
+  auto elapsed = std::chrono::high_resolution_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
@@ -3,9 +3,12 @@
  *
  * It can also print a PNG file showing how each glyph has been rendered.
 *
- * Usage: rasterizer font_name glyph_width glyph_height
+ * Usage: rasterizer font_name glyph_width glyph_height bits_per_pixel
  * -> Generates a .png image with the font rasterized
- * -> Generates a .c file with the content of the font */
+ * -> Generates a .c file with the content of the font
+ *
+ * The intensity of each pixel is quantized to bits_per_pixel bits, and the
+ * pixels of a glyph are packed row after row, most significant bits first. */
 
 #include <stdio.h>
 #include <string.h>
@@ -49,25 +52,27 @@ void writeImageToPNGFile(image_t * image, char * filename);
 #endif
 
 void drawGlyphInImage(FT_Bitmap * glyphBitmap, image_t * image, int x, int y);
+void writeGlyphToSourceFile(FILE * sourceFile, image_t * image, int characterX, int characterY, int glyph_width, int glyph_height, int bits_per_pixel);
 
 int main(int argc, char * argv[]) {
   FT_Library library;
   FT_Face face;
   image_t bitmap_image;
 
-  int expectedNumberOfArguments = 7;
+  int expectedNumberOfArguments = 8;
 #ifdef GENERATE_PNG
-  expectedNumberOfArguments = 8;
+  expectedNumberOfArguments = 9;
 #endif
   if (argc != expectedNumberOfArguments) {
 #ifdef GENERATE_PNG
-    fprintf(stderr, "Usage: %s font_file glyph_width glyph_height font_name output_header output_implementation output_png\n", argv[0]);
+    fprintf(stderr, "Usage: %s font_file glyph_width glyph_height bits_per_pixel font_name output_header output_implementation output_png\n", argv[0]);
 #else
-    fprintf(stderr, "Usage: %s font_file glyph_width glyph_height font_name output_header output_implementation\n", argv[0]);
+    fprintf(stderr, "Usage: %s font_file glyph_width glyph_height bits_per_pixel font_name output_header output_implementation\n", argv[0]);
 #endif
     fprintf(stderr, "  font_file: Path of the font file to load\n");
     fprintf(stderr, "  glyph_width: Width of bitmap glyphs, in pixels\n");
     fprintf(stderr, "  glyph_height: Height of bitmap glyphs, in pixels\n");
+    fprintf(stderr, "  bits_per_pixel: Number of bits of the intensity of a pixel: 1, 2, 4 or 8\n");
     fprintf(stderr, "  font_name: name of the loaded font\n");
     fprintf(stderr, "  output_header: Name of the generated C header file\n");
     fprintf(stderr, "  output_implementation: Name of the generated C source file\n");
@@ -80,13 +85,16 @@ int main(int argc, char * argv[]) {
   char * font_file = argv[1];
   int requested_glyph_width = atoi(argv[2]);
   int requested_glyph_height = atoi(argv[3]);
-  char * font_name = argv[4];
-  char * output_header = argv[5];
-  char * output_implementation = argv[6];
+  int bits_per_pixel = atoi(argv[4]);
+  char * font_name = argv[5];
+  char * output_header = argv[6];
+  char * output_implementation = argv[7];
 #ifdef GENERATE_PNG
-  char * output_png = argv[7];
+  char * output_png = argv[8];
 #endif
 
+  ENSURE(bits_per_pixel == 1 || bits_per_pixel == 2 || bits_per_pixel == 4 || bits_per_pixel == 8, "Checking %d bits per pixel divide a byte", bits_per_pixel);
+
   ENSURE(!FT_Init_FreeType(&library), "Initializing library");
 
   // 0 means we're picking the first face in the provided file
@@ -188,63 +196,28 @@ int main(int argc, char * argv[]) {
   writeImageToPNGFile(&bitmap_image, output_png);
 #endif
 
+  int number_of_glyphs = NUMBER_OF_SYMBOLS+CHARACTER_RANGE_END-CHARACTER_RANGE_START+1;
+  int glyph_size = (glyph_width*glyph_height*bits_per_pixel+7)/8;
+
   FILE * headerFile = fopen(output_header, "w");
   fprintf(headerFile, "/* Auto-generated by rasterizer */\n\n");
   fprintf(headerFile, "#define BITMAP_%s_FIRST_CHARACTER 0x%2x\n", font_name, CHARACTER_RANGE_START);
   fprintf(headerFile, "#define BITMAP_%s_LAST_CHARACTER 0x%2x\n\n", font_name, CHARACTER_RANGE_END+NUMBER_OF_SYMBOLS);
   fprintf(headerFile, "#define BITMAP_%s_CHARACTER_WIDTH %d\n", font_name, glyph_width);
   fprintf(headerFile, "#define BITMAP_%s_CHARACTER_HEIGHT %d\n\n", font_name, glyph_height);
-  fprintf(headerFile, "extern const unsigned char bitmap%s[%d][%d][%d];\n", font_name, NUMBER_OF_SYMBOLS+CHARACTER_RANGE_END-CHARACTER_RANGE_START+1, glyph_height, glyph_width);
+  fprintf(headerFile, "#define BITMAP_%s_BITS_PER_PIXEL %d\n", font_name, bits_per_pixel);
+  fprintf(headerFile, "#define BITMAP_%s_GLYPH_SIZE %d\n\n", font_name, glyph_size);
+  fprintf(headerFile, "extern const unsigned char bitmap%s[%d][%d];\n", font_name, number_of_glyphs, glyph_size);
   fclose(headerFile);
 
   FILE * sourceFile = fopen(output_implementation, "w");
   fprintf(sourceFile, "/* Auto-generated by rasterizer */\n\n");
-  fprintf(sourceFile, "const unsigned char bitmap%s[%d][%d][%d] = {\n", font_name, NUMBER_OF_SYMBOLS+CHARACTER_RANGE_END-CHARACTER_RANGE_START+1, glyph_height, glyph_width);
-  for (unsigned char character = CHARACTER_RANGE_START; character <= CHARACTER_RANGE_END; character++) {
-    fprintf(sourceFile, "  {\n");
-    int characterX = ((character-CHARACTER_RANGE_START)%GRID_WIDTH * (glyph_width+grid_size));
-    int characterY = ((character-CHARACTER_RANGE_START)/GRID_WIDTH * (glyph_height+grid_size));
-    for (int y = 0; y < glyph_height; y++) {
-      fprintf(sourceFile, "    {");
-      for (int x = 0; x < glyph_width; x++) {
-        pixel_t * pixel = (bitmap_image.pixels + (y+characterY)*bitmap_image.width + (x+characterX));
-        fprintf(sourceFile, "0x%02x", 0xFF - pixel->green);
-        if (x+1 < glyph_width) {
-          fprintf(sourceFile, ", ");
-        }
-      }
-      fprintf(sourceFile, "}");
-      if (y+1 < glyph_height) {
-        fprintf(sourceFile, ",");
-      }
-      fprintf(sourceFile, "\n");
-    }
-    fprintf(sourceFile, "  }");
-    fprintf(sourceFile, ",");
-    fprintf(sourceFile, "\n");
-  }
-  for (int charIndex = 0; charIndex < NUMBER_OF_SYMBOLS; charIndex++) {
-    wchar_t wideChar = codePointForSymbol[charIndex];
-    fprintf(sourceFile, "  {\n");
-    int characterX = ((charIndex+1+CHARACTER_RANGE_END-CHARACTER_RANGE_START)%GRID_WIDTH * (glyph_width+grid_size));
-    int characterY = ((charIndex+1+CHARACTER_RANGE_END-CHARACTER_RANGE_START)/GRID_WIDTH * (glyph_height+grid_size));
-    for (int y = 0; y < glyph_height; y++) {
-      fprintf(sourceFile, "    {");
-      for (int x = 0; x < glyph_width; x++) {
-        pixel_t * pixel = (bitmap_image.pixels + (y+characterY)*bitmap_image.width + (x+characterX));
-        fprintf(sourceFile, "0x%02x", 0xFF - pixel->green);
-        if (x+1 < glyph_width) {
-          fprintf(sourceFile, ", ");
-        }
-      }
-      fprintf(sourceFile, "}");
-      if (y+1 < glyph_height) {
-        fprintf(sourceFile, ",");
-      }
-      fprintf(sourceFile, "\n");
-    }
-    fprintf(sourceFile, "  }");
-    if (charIndex < NUMBER_OF_SYMBOLS - 1) {
+  fprintf(sourceFile, "const unsigned char bitmap%s[%d][%d] = {\n", font_name, number_of_glyphs, glyph_size);
+  for (int glyphIndex = 0; glyphIndex < number_of_glyphs; glyphIndex++) {
+    int characterX = (glyphIndex%GRID_WIDTH * (glyph_width+grid_size));
+    int characterY = (glyphIndex/GRID_WIDTH * (glyph_height+grid_size));
+    writeGlyphToSourceFile(sourceFile, &bitmap_image, characterX, characterY, glyph_width, glyph_height, bits_per_pixel);
+    if (glyphIndex < number_of_glyphs - 1) {
       fprintf(sourceFile, ",");
     }
     fprintf(sourceFile, "\n");
@@ -270,6 +243,31 @@ void drawGlyphInImage(FT_Bitmap * glyphBitmap, image_t * image, int x, int y) {
   }
 }
 
+void writeGlyphToSourceFile(FILE * sourceFile, image_t * image, int characterX, int characterY, int glyph_width, int glyph_height, int bits_per_pixel) {
+  int maxValue = (1 << bits_per_pixel) - 1;
+  int bitOffset = 0;
+  uint8_t byte = 0;
+  fprintf(sourceFile, "  {");
+  for (int y = 0; y < glyph_height; y++) {
+    for (int x = 0; x < glyph_width; x++) {
+      pixel_t * pixel = (image->pixels + (y+characterY)*image->width + (x+characterX));
+      int intensity = 0xFF - pixel->green;
+      int value = (intensity*maxValue + 0x7F)/0xFF;
+      byte |= value << (8 - bits_per_pixel - bitOffset);
+      bitOffset += bits_per_pixel;
+      if (bitOffset == 8 || (x+1 == glyph_width && y+1 == glyph_height)) {
+        fprintf(sourceFile, "0x%02x", byte);
+        if (x+1 < glyph_width || y+1 < glyph_height) {
+          fprintf(sourceFile, ", ");
+        }
+        bitOffset = 0;
+        byte = 0;
+      }
+    }
+  }
+  fprintf(sourceFile, "}");
+}
+
 #if GENERATE_PNG
 
 void writeImageToPNGFile(image_t * image, char * filename) {
@@ -9,7 +9,9 @@
 #include <kandinsky/ion_context.h>
 #include <kandinsky/point.h>
 #include <kandinsky/rect.h>
+#include <kandinsky/region.h>
 #include <kandinsky/size.h>
 #include <kandinsky/text.h>
+#include <kandinsky/tile_context.h>
 
 #endif
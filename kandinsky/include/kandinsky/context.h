@@ -34,7 +34,7 @@ protected:
 private:
   KDRect absoluteFillRect(KDRect rect);
   KDPoint writeString(const char * text, KDPoint p, KDText::FontSize size, KDColor textColor, KDColor backgroundColor, int maxLength, bool transparentBackground);
-  void writeChar(char character, KDPoint p, KDText::FontSize size, KDColor textColor, KDColor backgroundColor, bool transparentBackground);
+  void writeRun(const char * text, int length, KDPoint p, KDText::FontSize size, KDColor textColor, KDColor backgroundColor, bool transparentBackground);
   KDPoint m_origin;
   KDRect m_clippingRect;
 };
@@ -0,0 +1,30 @@
+#ifndef KANDINSKY_REGION_H
+#define KANDINSKY_REGION_H
+
+#include <kandinsky/rect.h>
+#include <stdint.h>
+
+/* A KDRegion covers a set of pixels with a few disjoint rectangles. A rect
+ * added to the region is merged with the rects it intersects, so that the
+ * rects stay disjoint. When the region is full, the new rect is merged with
+ * the rect whose union with it adds the fewest uncovered pixels: the region
+ * may then cover more pixels than were added, never fewer. */
+
+class KDRegion {
+public:
+  constexpr static int k_maxNumberOfRects = 3;
+  KDRegion();
+  int numberOfRects() const { return m_numberOfRects; }
+  KDRect rectAtIndex(int i) const;
+  bool isEmpty() const { return m_numberOfRects == 0; }
+  void addRect(KDRect rect);
+  void clear() { m_numberOfRects = 0; }
+  // Returns the smallest rectangle containing the region
+  KDRect bounds() const;
+private:
+  void removeRectAtIndex(int i);
+  KDRect m_rects[k_maxNumberOfRects];
+  uint8_t m_numberOfRects;
+};
+
+#endif
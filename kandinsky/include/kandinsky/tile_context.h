@@ -0,0 +1,49 @@
+#ifndef KANDINSKY_TILE_CONTEXT_H
+#define KANDINSKY_TILE_CONTEXT_H
+
+#include <kandinsky/context.h>
+#include <kandinsky/framebuffer.h>
+
+/* A KDTileContext renders into a tile of pixels kept in RAM instead of sending
+ * every drawing command to the display. Overlapping drawings (backgrounds
+ * redrawn under cells, text drawn over grids...) thus only cost a memory
+ * write, and the final pixels of the tile are pushed once to the display when
+ * the tile is flushed.
+ * Only the pixels of the tile can be drawn: the clipping rect must be
+ * included in the tile. The pixels of the display that are read before being
+ * drawn are pulled lazily. */
+
+class KDTileContext : public KDContext {
+public:
+  static KDTileContext * sharedContext();
+  /* A 320x8 strip of pixels: 5KB of static RAM. Taller strips do not push
+   * fewer pixels, they only save a few traversals of the view hierarchy. */
+  static constexpr int k_bufferSize = 320*8;
+  void setTile(KDRect tile);
+  KDRect tile() const { return m_tile; }
+  void flush();
+protected:
+  KDTileContext();
+  virtual void pushRectToDisplay(KDRect rect, const KDColor * pixels);
+  virtual void pullRectFromDisplay(KDRect rect, KDColor * pixels);
+private:
+  void pushRect(KDRect rect, const KDColor * pixels) override;
+  void pushRectUniform(KDRect rect, KDColor color) override;
+  void pullRect(KDRect rect, KDColor * pixels) override;
+  bool tileContains(KDRect rect) const;
+  /* Extend the loaded rect to contain rect, pulling from the display the new
+   * pixels that are not about to be overwritten. */
+  void loadRect(KDRect rect, bool isOverwritten);
+  void pullRowsFromDisplay(KDCoordinate left, KDCoordinate right, KDCoordinate top, KDCoordinate bottom);
+  KDColor * pixelAddress(KDPoint p);
+  KDRect m_tile;
+  /* The loaded rect bounds the pixels of the tile that hold the content of
+   * the display, and the drawn rect the pixels modified since the last flush.
+   * The drawn rect is included in the loaded rect. */
+  KDRect m_loadedRect;
+  KDRect m_drawnRect;
+  KDFrameBuffer m_frameBuffer;
+  KDColor m_pixels[k_bufferSize];
+};
+
+#endif
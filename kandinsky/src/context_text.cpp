@@ -2,9 +2,38 @@
 #include <kandinsky/text.h>
 #include "small_font.h"
 #include "large_font.h"
+#include "glyph_cache.h"
+#include "font.h"
+#include <string.h>
 
-KDColor smallCharacterBuffer[BITMAP_SmallFont_CHARACTER_WIDTH*BITMAP_SmallFont_CHARACTER_HEIGHT];
-KDColor largeCharacterBuffer[BITMAP_LargeFont_CHARACTER_WIDTH*BITMAP_LargeFont_CHARACTER_HEIGHT];
+/* The characters of a run are laid out in a buffer pushed at once. A run
+ * holds at most k_runBufferSize/(characterWidth*characterHeight) characters:
+ * 8 large or 17 small ones. Longer strings are rare and only cost one more
+ * push per run, so the buffer is kept small (2880 bytes of static RAM). */
+static constexpr int k_runBufferSize = 8*BITMAP_LargeFont_CHARACTER_WIDTH*BITMAP_LargeFont_CHARACTER_HEIGHT;
+static KDColor runBuffer[k_runBufferSize];
+
+template<int bitsPerPixel>
+static inline void decodePixels(const unsigned char * glyph, int firstPixel, int numberOfPixels, uint8_t * intensities) {
+  static_assert(8 % bitsPerPixel == 0, "The pixels of a glyph must not straddle two bytes");
+  constexpr int maxValue = (1 << bitsPerPixel) - 1;
+  int bit = firstPixel*bitsPerPixel;
+  for (int i = 0; i < numberOfPixels; i++) {
+    int value = (glyph[bit/8] >> (8 - bitsPerPixel - bit%8)) & maxValue;
+    intensities[i] = value*0xFF/maxValue;
+    bit += bitsPerPixel;
+  }
+}
+
+void KDDecodeGlyphRow(char character, KDText::FontSize size, int row, int firstColumn, int numberOfPixels, uint8_t * intensities) {
+  if (size == KDText::FontSize::Large) {
+    const unsigned char * glyph = bitmapLargeFont[(uint8_t)character-BITMAP_LargeFont_FIRST_CHARACTER];
+    decodePixels<BITMAP_LargeFont_BITS_PER_PIXEL>(glyph, row*BITMAP_LargeFont_CHARACTER_WIDTH + firstColumn, numberOfPixels, intensities);
+  } else {
+    const unsigned char * glyph = bitmapSmallFont[(uint8_t)character-BITMAP_SmallFont_FIRST_CHARACTER];
+    decodePixels<BITMAP_SmallFont_BITS_PER_PIXEL>(glyph, row*BITMAP_SmallFont_CHARACTER_WIDTH + firstColumn, numberOfPixels, intensities);
+  }
+}
 
 KDPoint KDContext::drawString(const char * text, KDPoint p, KDText::FontSize size, KDColor textColor, KDColor backgroundColor, int maxLength) {
   return writeString(text, p, size, textColor, backgroundColor, maxLength, false);
@@ -16,55 +45,72 @@ KDPoint KDContext::blendString(const char * text, KDPoint p, KDText::FontSize si
 
 KDPoint KDContext::writeString(const char * text, KDPoint p, KDText::FontSize size, KDColor textColor, KDColor backgroundColor, int maxLength, bool transparentBackground) {
   KDPoint position = p;
-  int characterWidth = size == KDText::FontSize::Large ? BITMAP_LargeFont_CHARACTER_WIDTH : BITMAP_SmallFont_CHARACTER_WIDTH;
-  int characterHeight = size == KDText::FontSize::Large ? BITMAP_LargeFont_CHARACTER_HEIGHT: BITMAP_SmallFont_CHARACTER_HEIGHT;
-  KDPoint characterSize(characterWidth, 0);
+  KDSize characterSize = KDText::charSize(size);
+  int maxRunLength = k_runBufferSize/(characterSize.width()*characterSize.height());
 
   const char * end = text+maxLength;
   while(*text != 0 && text != end) {
-    writeChar(*text, position, size, textColor, backgroundColor, transparentBackground);
     if (*text == '\n') {
-      position = KDPoint(0, position.y()+characterHeight);
+      position = KDPoint(0, position.y()+characterSize.height());
+      text++;
     } else if (*text == '\t') {
-      position = position.translatedBy(KDPoint(KDText::k_tabCharacterWidth*characterWidth, 0));
+      position = position.translatedBy(KDPoint(KDText::k_tabCharacterWidth*characterSize.width(), 0));
+      text++;
     } else {
-      position = position.translatedBy(characterSize);
+      int runLength = 0;
+      while (text[runLength] != 0 && text+runLength != end && text[runLength] != '\n' && text[runLength] != '\t' && runLength < maxRunLength) {
+        runLength++;
+      }
+      writeRun(text, runLength, position, size, textColor, backgroundColor, transparentBackground);
+      position = position.translatedBy(KDPoint(runLength*characterSize.width(), 0));
+      text += runLength;
     }
-    text++;
   }
   return position;
 }
 
-void KDContext::writeChar(char character, KDPoint p, KDText::FontSize size, KDColor textColor, KDColor backgroundColor, bool transparentBackground) {
-  if (character == '\n' || character == '\t') {
-    return;
-  }
-  char firstCharacter = size == KDText::FontSize::Large ? BITMAP_LargeFont_FIRST_CHARACTER : BITMAP_SmallFont_FIRST_CHARACTER;
+void KDContext::writeRun(const char * text, int length, KDPoint p, KDText::FontSize size, KDColor textColor, KDColor backgroundColor, bool transparentBackground) {
   int characterHeight = size == KDText::FontSize::Large ? BITMAP_LargeFont_CHARACTER_HEIGHT : BITMAP_SmallFont_CHARACTER_HEIGHT;
   int characterWidth = size == KDText::FontSize::Large ? BITMAP_LargeFont_CHARACTER_WIDTH : BITMAP_SmallFont_CHARACTER_WIDTH;
 
-  KDColor * characterBuffer = size == KDText::FontSize::Large ? largeCharacterBuffer : smallCharacterBuffer;
-
-  KDRect absoluteRect = absoluteFillRect(KDRect(p, characterWidth, characterHeight));
+  KDRect absoluteRect = absoluteFillRect(KDRect(p, length*characterWidth, characterHeight));
+  if (absoluteRect.isEmpty()) {
+    return;
+  }
   if (transparentBackground) {
-    pullRect(absoluteRect, characterBuffer);
+    pullRect(absoluteRect, runBuffer);
   }
   KDCoordinate startingI = m_clippingRect.x() - p.translatedBy(m_origin).x();
   KDCoordinate startingJ = m_clippingRect.y() - p.translatedBy(m_origin).y();
   startingI = startingI < 0 ? 0 : startingI;
   startingJ = startingJ < 0 ? 0 : startingJ;
 
-  for (KDCoordinate j=0; j<absoluteRect.height(); j++) {
-    for (KDCoordinate i=0; i<absoluteRect.width(); i++) {
-      KDColor * currentPixelAdress = characterBuffer + i + absoluteRect.width()*j;         uint8_t intensity = 0;
-      if (size == KDText::FontSize::Large) {
-        intensity = bitmapLargeFont[(uint8_t)character-(uint8_t)firstCharacter][j + startingJ][i +startingI];
-      } else {
-       intensity = bitmapSmallFont[(uint8_t)character-(uint8_t)firstCharacter][j + startingJ][i +startingI];
+  // Lay out the visible columns of each character in the run buffer
+  KDCoordinate runI = 0;
+  while (runI < absoluteRect.width()) {
+    int characterIndex = (startingI + runI)/characterWidth;
+    char character = text[characterIndex];
+    KDCoordinate characterI = (startingI + runI) - characterIndex*characterWidth;
+    KDCoordinate width = characterWidth - characterI;
+    if (width > absoluteRect.width() - runI) {
+      width = absoluteRect.width() - runI;
+    }
+    if (transparentBackground) {
+      uint8_t intensities[BITMAP_LargeFont_CHARACTER_WIDTH];
+      for (KDCoordinate j=0; j<absoluteRect.height(); j++) {
+        KDColor * currentPixelAdress = runBuffer + runI + absoluteRect.width()*j;
+        KDDecodeGlyphRow(character, size, j + startingJ, characterI, width, intensities);
+        for (KDCoordinate i=0; i<width; i++) {
+          currentPixelAdress[i] = KDColor::blend(textColor, currentPixelAdress[i], intensities[i]);
+        }
+      }
+    } else {
+      const KDColor * glyph = KDGlyphCache::Glyph(character, size, textColor, backgroundColor);
+      for (KDCoordinate j=0; j<absoluteRect.height(); j++) {
+        memcpy(runBuffer + runI + absoluteRect.width()*j, glyph + characterI + characterWidth*(j + startingJ), width*sizeof(KDColor));
       }
-      KDColor backColor = transparentBackground ? *currentPixelAdress : backgroundColor;
-      *currentPixelAdress = KDColor::blend(textColor, backColor, intensity);
     }
+    runI += width;
   }
-  pushRect(absoluteRect, characterBuffer);
+  pushRect(absoluteRect, runBuffer);
 }
@@ -0,0 +1,13 @@
+#ifndef KANDINSKY_FONT_H
+#define KANDINSKY_FONT_H
+
+#include <kandinsky/text.h>
+#include <stdint.h>
+
+/* The glyphs are stored with a few bits of intensity per pixel, packed row
+ * after row. KDDecodeGlyphRow unpacks the intensities of numberOfPixels pixels
+ * of a row of the glyph of character, starting at column firstColumn. */
+
+void KDDecodeGlyphRow(char character, KDText::FontSize size, int row, int firstColumn, int numberOfPixels, uint8_t * intensities);
+
+#endif
@@ -0,0 +1,47 @@
+#include "glyph_cache.h"
+#include "font.h"
+
+const KDColor * KDGlyphCache::Glyph(char character, KDText::FontSize size, KDColor textColor, KDColor backgroundColor) {
+  return sharedCache()->glyph(character, size, textColor, backgroundColor);
+}
+
+KDGlyphCache * KDGlyphCache::sharedCache() {
+  static KDGlyphCache cache;
+  return &cache;
+}
+
+KDGlyphCache::KDGlyphCache() :
+  m_numberOfEntries(0),
+  m_clock(0)
+{
+}
+
+const KDColor * KDGlyphCache::glyph(char character, KDText::FontSize size, KDColor textColor, KDColor backgroundColor) {
+  m_clock++;
+  int index = 0;
+  for (int i = 0; i < m_numberOfEntries; i++) {
+    Entry * entry = m_entries + i;
+    if (entry->character == character && entry->size == size && entry->textColor == textColor && entry->backgroundColor == backgroundColor) {
+      entry->lastUse = m_clock;
+      return m_glyphs[i];
+    }
+    if (entry->lastUse < m_entries[index].lastUse) {
+      index = i;
+    }
+  }
+  if (m_numberOfEntries < k_numberOfGlyphs) {
+    index = m_numberOfEntries++;
+  }
+  m_entries[index] = Entry{character, size, textColor, backgroundColor, m_clock};
+  KDColor * pixels = m_glyphs[index];
+  KDSize characterSize = KDText::charSize(size);
+  uint8_t intensities[BITMAP_LargeFont_CHARACTER_WIDTH];
+  for (int j = 0; j < characterSize.height(); j++) {
+    KDDecodeGlyphRow(character, size, j, 0, characterSize.width(), intensities);
+    for (int i = 0; i < characterSize.width(); i++) {
+      pixels[i] = KDColor::blend(textColor, backgroundColor, intensities[i]);
+    }
+    pixels += characterSize.width();
+  }
+  return m_glyphs[index];
+}
@@ -0,0 +1,41 @@
+#ifndef KANDINSKY_GLYPH_CACHE_H
+#define KANDINSKY_GLYPH_CACHE_H
+
+#include <kandinsky/color.h>
+#include <kandinsky/text.h>
+#include "small_font.h"
+#include "large_font.h"
+
+/* The KDGlyphCache keeps the last glyphs drawn already blended with their text
+ * and background colors, so that drawing an opaque string mostly consists in
+ * copying pixels. Glyphs of different colors live side by side, and the least
+ * recently used glyph is evicted. */
+
+class KDGlyphCache {
+public:
+  /* The returned pixels are a characterWidth x characterHeight rect, valid
+   * until the next call. */
+  static const KDColor * Glyph(char character, KDText::FontSize size, KDColor textColor, KDColor backgroundColor);
+private:
+  /* 16 glyphs take 5952 bytes of static RAM. Over the blackbox scenarios,
+   * they serve 66% of the glyphs drawn, against 41% for 8 glyphs. */
+  constexpr static int k_numberOfGlyphs = 16;
+  constexpr static int k_glyphBufferSize = BITMAP_LargeFont_CHARACTER_WIDTH*BITMAP_LargeFont_CHARACTER_HEIGHT;
+  static_assert(BITMAP_SmallFont_CHARACTER_WIDTH*BITMAP_SmallFont_CHARACTER_HEIGHT <= k_glyphBufferSize, "The glyph buffer cannot hold a small glyph");
+  struct Entry {
+    char character;
+    KDText::FontSize size;
+    KDColor textColor;
+    KDColor backgroundColor;
+    uint32_t lastUse;
+  };
+  static KDGlyphCache * sharedCache();
+  KDGlyphCache();
+  const KDColor * glyph(char character, KDText::FontSize size, KDColor textColor, KDColor backgroundColor);
+  int m_numberOfEntries;
+  uint32_t m_clock;
+  Entry m_entries[k_numberOfGlyphs];
+  KDColor m_glyphs[k_numberOfGlyphs][k_glyphBufferSize];
+};
+
+#endif
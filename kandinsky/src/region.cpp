@@ -0,0 +1,66 @@
+#include <kandinsky/region.h>
+#include <assert.h>
+
+static int area(KDRect rect) {
+  return (int)rect.width()*(int)rect.height();
+}
+
+KDRegion::KDRegion() :
+  m_rects{KDRectZero, KDRectZero, KDRectZero},
+  m_numberOfRects(0)
+{
+  static_assert(k_maxNumberOfRects == 3, "Every rect of the region must be initialized");
+}
+
+KDRect KDRegion::rectAtIndex(int i) const {
+  assert(i >= 0 && i < m_numberOfRects);
+  return m_rects[i];
+}
+
+void KDRegion::addRect(KDRect rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  int i = 0;
+  while (i < m_numberOfRects) {
+    if (m_rects[i].intersects(rect)) {
+      /* The union may now intersect rects that were already checked, hence
+       * the restart. */
+      rect = rect.unionedWith(m_rects[i]);
+      removeRectAtIndex(i);
+      i = 0;
+      continue;
+    }
+    i++;
+  }
+  if (m_numberOfRects < k_maxNumberOfRects) {
+    m_rects[m_numberOfRects++] = rect;
+    return;
+  }
+  int bestIndex = 0;
+  int bestCost = 0;
+  for (int j = 0; j < m_numberOfRects; j++) {
+    int cost = area(rect.unionedWith(m_rects[j])) - area(rect) - area(m_rects[j]);
+    if (j == 0 || cost < bestCost) {
+      bestIndex = j;
+      bestCost = cost;
+    }
+  }
+  rect = rect.unionedWith(m_rects[bestIndex]);
+  removeRectAtIndex(bestIndex);
+  addRect(rect);
+}
+
+KDRect KDRegion::bounds() const {
+  KDRect result = KDRectZero;
+  for (int i = 0; i < m_numberOfRects; i++) {
+    result = result.unionedWith(m_rects[i]);
+  }
+  return result;
+}
+
+void KDRegion::removeRectAtIndex(int i) {
+  assert(i >= 0 && i < m_numberOfRects);
+  m_numberOfRects--;
+  m_rects[i] = m_rects[m_numberOfRects];
+}
@@ -0,0 +1,149 @@
+#include <kandinsky/tile_context.h>
+#include <ion.h>
+#include <assert.h>
+#include <string.h>
+
+static inline KDCoordinate minCoordinate(KDCoordinate x, KDCoordinate y) { return x < y ? x : y; }
+static inline KDCoordinate maxCoordinate(KDCoordinate x, KDCoordinate y) { return x > y ? x : y; }
+
+KDTileContext * KDTileContext::sharedContext() {
+  static KDTileContext context;
+  return &context;
+}
+
+KDTileContext::KDTileContext() :
+  KDContext(KDPointZero, KDRectZero),
+  m_tile(KDRectZero),
+  m_loadedRect(KDRectZero),
+  m_drawnRect(KDRectZero),
+  m_frameBuffer(m_pixels, KDSize(0, 0))
+{
+}
+
+void KDTileContext::setTile(KDRect tile) {
+  assert(tile.width()*tile.height() <= k_bufferSize);
+  assert(m_drawnRect.isEmpty());
+  m_tile = tile;
+  m_loadedRect = KDRectZero;
+  m_frameBuffer = KDFrameBuffer(m_pixels, tile.size());
+  setOrigin(KDPointZero);
+  setClippingRect(tile);
+}
+
+void KDTileContext::flush() {
+  if (!m_drawnRect.isEmpty()) {
+    KDColor * pixels = pixelAddress(m_drawnRect.origin());
+    if (m_drawnRect.width() != m_tile.width()) {
+      /* Gather the rows of the drawn rect at the beginning of the buffer to push
+       * them at once. A row never moves past the beginning of the next one. */
+      pixels = m_pixels;
+      for (KDCoordinate j = 0; j < m_drawnRect.height(); j++) {
+        memmove(m_pixels + j*m_drawnRect.width(), pixelAddress(KDPoint(m_drawnRect.x(), m_drawnRect.y()+j)), m_drawnRect.width()*sizeof(KDColor));
+      }
+    }
+    pushRectToDisplay(m_drawnRect, pixels);
+  }
+  m_loadedRect = KDRectZero;
+  m_drawnRect = KDRectZero;
+}
+
+void KDTileContext::pushRectToDisplay(KDRect rect, const KDColor * pixels) {
+  Ion::Display::pushRect(rect, pixels);
+}
+
+void KDTileContext::pullRectFromDisplay(KDRect rect, KDColor * pixels) {
+  Ion::Display::pullRect(rect, pixels);
+}
+
+void KDTileContext::pushRect(KDRect rect, const KDColor * pixels) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  assert(tileContains(rect));
+  loadRect(rect, true);
+  m_frameBuffer.pushRect(rect.translatedBy(m_tile.origin().opposite()), pixels);
+  m_drawnRect = m_drawnRect.unionedWith(rect);
+}
+
+void KDTileContext::pushRectUniform(KDRect rect, KDColor color) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  assert(tileContains(rect));
+  loadRect(rect, true);
+  m_frameBuffer.pushRectUniform(rect.translatedBy(m_tile.origin().opposite()), color);
+  m_drawnRect = m_drawnRect.unionedWith(rect);
+}
+
+void KDTileContext::pullRect(KDRect rect, KDColor * pixels) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  assert(tileContains(rect));
+  loadRect(rect, false);
+  m_frameBuffer.pullRect(rect.translatedBy(m_tile.origin().opposite()), pixels);
+}
+
+bool KDTileContext::tileContains(KDRect rect) const {
+  return m_tile.intersectedWith(rect) == rect;
+}
+
+void KDTileContext::loadRect(KDRect rect, bool isOverwritten) {
+  KDRect loadedRect = m_loadedRect.unionedWith(rect);
+  if (loadedRect == m_loadedRect) {
+    return;
+  }
+  /* The pixels to pull are the ones of the new loaded rect that are neither
+   * already loaded nor overwritten. The rows are split in bands along which
+   * these known pixels are the same intervals. */
+  constexpr int numberOfKnownRects = 2;
+  KDRect knownRects[numberOfKnownRects] = {m_loadedRect, isOverwritten ? rect : KDRectZero};
+  if (knownRects[1].left() < knownRects[0].left()) {
+    KDRect swappedRect = knownRects[0];
+    knownRects[0] = knownRects[1];
+    knownRects[1] = swappedRect;
+  }
+  KDCoordinate top = loadedRect.top();
+  while (top <= loadedRect.bottom()) {
+    KDCoordinate bottom = loadedRect.bottom();
+    for (int i = 0; i < numberOfKnownRects; i++) {
+      const KDRect & known = knownRects[i];
+      if (known.isEmpty() || top > known.bottom()) {
+        continue;
+      }
+      bottom = minCoordinate(bottom, top < known.top() ? known.top()-1 : known.bottom());
+    }
+    KDCoordinate left = loadedRect.left();
+    for (int i = 0; i < numberOfKnownRects; i++) {
+      const KDRect & known = knownRects[i];
+      if (known.isEmpty() || top < known.top() || top > known.bottom()) {
+        continue;
+      }
+      if (known.left() > left) {
+        pullRowsFromDisplay(left, known.left()-1, top, bottom);
+      }
+      left = maxCoordinate(left, known.right()+1);
+    }
+    if (left <= loadedRect.right()) {
+      pullRowsFromDisplay(left, loadedRect.right(), top, bottom);
+    }
+    top = bottom+1;
+  }
+  m_loadedRect = loadedRect;
+}
+
+void KDTileContext::pullRowsFromDisplay(KDCoordinate left, KDCoordinate right, KDCoordinate top, KDCoordinate bottom) {
+  KDCoordinate width = right-left+1;
+  KDCoordinate height = bottom-top+1;
+  if (width == m_tile.width()) {
+    pullRectFromDisplay(KDRect(left, top, width, height), pixelAddress(KDPoint(left, top)));
+  } else {
+    for (KDCoordinate y = top; y <= bottom; y++) {
+      pullRectFromDisplay(KDRect(left, y, width, 1), pixelAddress(KDPoint(left, y)));
+    }
+  }
+}
+
+KDColor * KDTileContext::pixelAddress(KDPoint p) {
+  return m_pixels + (p.x()-m_tile.x()) + (p.y()-m_tile.y())*m_tile.width();
+}
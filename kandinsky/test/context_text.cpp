@@ -0,0 +1,122 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+#include "../src/font.h"
+
+constexpr KDCoordinate k_width = 64;
+constexpr KDCoordinate k_height = 48;
+
+/* Rows of glyphs rasterized with 8 bits of intensity per pixel. Whatever the
+ * number of bits per pixel of the fonts, the decoded intensities are within a
+ * quantization step of these. */
+constexpr uint8_t k_largeARows[][BITMAP_LargeFont_CHARACTER_WIDTH] = {
+  {0x00, 0x00, 0x35, 0xBF, 0xFE, 0xFF, 0xD2, 0x55, 0x00, 0x00},
+  {0x00, 0x13, 0xD4, 0x54, 0x0B, 0x0E, 0x59, 0xE3, 0x69, 0x00},
+  {0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xE7, 0x00}
+};
+constexpr int k_largeAFirstRow = 6;
+constexpr uint8_t k_largeFourRow[BITMAP_LargeFont_CHARACTER_WIDTH] = {0x00, 0xA5, 0x62, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00};
+constexpr int k_largeFourRowIndex = 9;
+constexpr uint8_t k_smallXRow[BITMAP_SmallFont_CHARACTER_WIDTH] = {0x0F, 0xDF, 0x50, 0x00, 0x4F, 0xDE, 0x0F};
+constexpr int k_smallXRowIndex = 4;
+
+static void assert_glyph_row_is_decoded(char character, KDText::FontSize size, int row, int firstColumn, int numberOfPixels, const uint8_t * reference) {
+  int bitsPerPixel = size == KDText::FontSize::Large ? BITMAP_LargeFont_BITS_PER_PIXEL : BITMAP_SmallFont_BITS_PER_PIXEL;
+  int maxValue = (1 << bitsPerPixel) - 1;
+  int tolerance = 0xFF/(2*maxValue) + 1;
+  uint8_t intensities[BITMAP_LargeFont_CHARACTER_WIDTH];
+  KDDecodeGlyphRow(character, size, row, firstColumn, numberOfPixels, intensities);
+  for (int i = 0; i < numberOfPixels; i++) {
+    int error = intensities[i] - reference[firstColumn+i];
+    assert(error <= tolerance && error >= -tolerance);
+  }
+}
+
+QUIZ_CASE(kandinsky_decode_glyph_rows) {
+  for (int j = 0; j < 3; j++) {
+    assert_glyph_row_is_decoded('a', KDText::FontSize::Large, k_largeAFirstRow+j, 0, BITMAP_LargeFont_CHARACTER_WIDTH, k_largeARows[j]);
+  }
+  assert_glyph_row_is_decoded('4', KDText::FontSize::Large, k_largeFourRowIndex, 0, BITMAP_LargeFont_CHARACTER_WIDTH, k_largeFourRow);
+  assert_glyph_row_is_decoded('x', KDText::FontSize::Small, k_smallXRowIndex, 0, BITMAP_SmallFont_CHARACTER_WIDTH, k_smallXRow);
+  // Part of a row, starting in the middle of a byte
+  assert_glyph_row_is_decoded('a', KDText::FontSize::Large, k_largeAFirstRow+1, 3, 5, k_largeARows[1]);
+  assert_glyph_row_is_decoded('x', KDText::FontSize::Small, k_smallXRowIndex, 1, 5, k_smallXRow);
+  // Full or empty pixels are decoded exactly
+  uint8_t intensity;
+  KDDecodeGlyphRow('4', KDText::FontSize::Large, k_largeFourRowIndex, 6, 1, &intensity);
+  assert(intensity == 0xFF);
+  KDDecodeGlyphRow(' ', KDText::FontSize::Large, k_largeFourRowIndex, 6, 1, &intensity);
+  assert(intensity == 0);
+}
+
+static KDColor expected_pixel(const KDColor * background, KDPoint p, const char * text, KDPoint origin, KDRect clippingRect, KDColor textColor) {
+  KDColor backgroundColor = background[p.x()+p.y()*k_width];
+  if (!clippingRect.contains(p)) {
+    return backgroundColor;
+  }
+  KDSize charSize = KDText::charSize(KDText::FontSize::Large);
+  KDPoint position = origin;
+  while (*text != 0) {
+    if (*text == '\n') {
+      position = KDPoint(0, position.y()+charSize.height());
+    } else if (*text == '\t') {
+      position = position.translatedBy(KDPoint(KDText::k_tabCharacterWidth*charSize.width(), 0));
+    } else {
+      KDRect characterRect(position, charSize);
+      if (characterRect.contains(p)) {
+        uint8_t intensity;
+        KDDecodeGlyphRow(*text, KDText::FontSize::Large, p.y()-position.y(), p.x()-position.x(), 1, &intensity);
+        return KDColor::blend(textColor, backgroundColor, intensity);
+      }
+      position = position.translatedBy(KDPoint(charSize.width(), 0));
+    }
+    text++;
+  }
+  return backgroundColor;
+}
+
+static void assert_string_is_drawn(const char * text, KDPoint p, KDRect clippingRect, bool blend, KDColor textColor = KDColorRed) {
+  static KDColor background[k_width*k_height];
+  static KDColor pixels[k_width*k_height];
+  for (int i = 0; i < k_width*k_height; i++) {
+    background[i] = blend ? KDColor::RGB16(i*97) : KDColorWhite;
+    pixels[i] = background[i];
+  }
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+  context.setClippingRect(clippingRect);
+  if (blend) {
+    context.blendString(text, p, KDText::FontSize::Large, textColor);
+  } else {
+    context.drawString(text, p, KDText::FontSize::Large, textColor, KDColorWhite);
+  }
+  for (int j = 0; j < k_height; j++) {
+    for (int i = 0; i < k_width; i++) {
+      assert(pixels[i+j*k_width] == expected_pixel(background, KDPoint(i, j), text, p, clippingRect, textColor));
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_draw_string) {
+  KDRect screen(0, 0, k_width, k_height);
+  assert_string_is_drawn("abc", KDPoint(1, 2), screen, false);
+  assert_string_is_drawn("12\t3\n45", KDPoint(0, 0), screen, false);
+  // Clipped on every side
+  assert_string_is_drawn("abcdefghij", KDPoint(-5, -3), KDRect(3, 4, 40, 20), false);
+  // Longer than a run of characters
+  assert_string_is_drawn("0123456789abcdefghijklm", KDPoint(2, 20), screen, false);
+}
+
+QUIZ_CASE(kandinsky_draw_string_in_several_colors) {
+  KDRect screen(0, 0, k_width, k_height);
+  // The glyphs cached in one color are not reused for another one
+  assert_string_is_drawn("abab", KDPoint(1, 2), screen, false, KDColorRed);
+  assert_string_is_drawn("abab", KDPoint(1, 2), screen, false, KDColorBlue);
+  assert_string_is_drawn("abab", KDPoint(1, 2), screen, false, KDColorRed);
+}
+
+QUIZ_CASE(kandinsky_blend_string) {
+  KDRect screen(0, 0, k_width, k_height);
+  assert_string_is_drawn("xyz", KDPoint(3, 5), screen, true);
+  assert_string_is_drawn("abcdefghij\nk", KDPoint(-5, -3), KDRect(3, 4, 40, 30), true);
+}
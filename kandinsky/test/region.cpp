@@ -0,0 +1,84 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+
+static bool region_covers(const KDRegion & region, KDRect rect) {
+  for (KDCoordinate j = rect.top(); j <= rect.bottom(); j++) {
+    for (KDCoordinate i = rect.left(); i <= rect.right(); i++) {
+      bool isCovered = false;
+      for (int k = 0; k < region.numberOfRects(); k++) {
+        isCovered = isCovered || region.rectAtIndex(k).contains(KDPoint(i, j));
+      }
+      if (!isCovered) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void assert_rects_are_disjoint(const KDRegion & region) {
+  for (int i = 0; i < region.numberOfRects(); i++) {
+    for (int j = i+1; j < region.numberOfRects(); j++) {
+      assert(!region.rectAtIndex(i).intersects(region.rectAtIndex(j)));
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_region_keeps_distant_rects_apart) {
+  KDRegion region;
+  assert(region.isEmpty());
+  region.addRect(KDRectZero);
+  assert(region.isEmpty());
+  KDRect cursor(2, 3, 1, 14);
+  KDRect banner(0, 200, 320, 22);
+  region.addRect(cursor);
+  region.addRect(banner);
+  assert(region.numberOfRects() == 2);
+  assert(region_covers(region, cursor) && region_covers(region, banner));
+  assert(region.bounds() == cursor.unionedWith(banner));
+  region.clear();
+  assert(region.isEmpty());
+}
+
+QUIZ_CASE(kandinsky_region_merges_intersecting_rects) {
+  KDRegion region;
+  region.addRect(KDRect(0, 0, 10, 10));
+  region.addRect(KDRect(20, 0, 10, 10));
+  assert(region.numberOfRects() == 2);
+  // Bridging both rects merges them into one
+  region.addRect(KDRect(5, 2, 20, 2));
+  assert(region.numberOfRects() == 1);
+  assert(region.rectAtIndex(0) == KDRect(0, 0, 30, 10));
+  // A rect already covered does not change the region
+  region.addRect(KDRect(3, 3, 2, 2));
+  assert(region.numberOfRects() == 1);
+  assert(region.rectAtIndex(0) == KDRect(0, 0, 30, 10));
+}
+
+QUIZ_CASE(kandinsky_region_merges_closest_rects_when_full) {
+  KDRegion region;
+  KDRect rects[] = {
+    KDRect(0, 0, 10, 10),
+    KDRect(100, 0, 10, 10),
+    KDRect(0, 100, 10, 10),
+    KDRect(12, 0, 10, 10),
+    KDRect(100, 100, 5, 5),
+    KDRect(8, 95, 10, 10)
+  };
+  int numberOfRects = sizeof(rects)/sizeof(KDRect);
+  for (int i = 0; i < numberOfRects; i++) {
+    region.addRect(rects[i]);
+    assert(region.numberOfRects() <= KDRegion::k_maxNumberOfRects);
+    assert_rects_are_disjoint(region);
+    for (int j = 0; j <= i; j++) {
+      assert(region_covers(region, rects[j]));
+    }
+  }
+  // The top left rects, closest to each other, were merged first
+  bool hasMergedTopLeftRects = false;
+  for (int i = 0; i < region.numberOfRects(); i++) {
+    hasMergedTopLeftRects = hasMergedTopLeftRects || region.rectAtIndex(i) == KDRect(0, 0, 22, 10);
+  }
+  assert(hasMergedTopLeftRects);
+}
@@ -0,0 +1,105 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+
+constexpr KDCoordinate k_width = 40;
+constexpr KDCoordinate k_height = 30;
+
+class FrameBufferTileContext : public KDTileContext {
+public:
+  FrameBufferTileContext(KDFrameBuffer * frameBuffer) :
+    KDTileContext(),
+    m_frameBuffer(frameBuffer),
+    m_numberOfPushedPixels(0),
+    m_numberOfPulledPixels(0)
+  {
+  }
+  int numberOfPushedPixels() const { return m_numberOfPushedPixels; }
+  int numberOfPulledPixels() const { return m_numberOfPulledPixels; }
+  void resetCounters() {
+    m_numberOfPushedPixels = 0;
+    m_numberOfPulledPixels = 0;
+  }
+private:
+  void pushRectToDisplay(KDRect rect, const KDColor * pixels) override {
+    m_numberOfPushedPixels += rect.width()*rect.height();
+    m_frameBuffer->pushRect(rect, pixels);
+  }
+  void pullRectFromDisplay(KDRect rect, KDColor * pixels) override {
+    m_numberOfPulledPixels += rect.width()*rect.height();
+    m_frameBuffer->pullRect(rect, pixels);
+  }
+  KDFrameBuffer * m_frameBuffer;
+  int m_numberOfPushedPixels;
+  int m_numberOfPulledPixels;
+};
+
+static void fill_with_pattern(KDColor * pixels) {
+  for (int i = 0; i < k_width*k_height; i++) {
+    pixels[i] = KDColor::RGB16(i*37);
+  }
+}
+
+static void draw(KDContext * ctx) {
+  ctx->fillRect(KDRect(2, 3, 10, 8), KDColorRed);
+  ctx->fillRect(KDRect(5, 6, 30, 12), KDColorBlue);
+  uint8_t mask[6*5];
+  for (int i = 0; i < 6*5; i++) {
+    mask[i] = 8*i;
+  }
+  KDColor workingBuffer[6*5];
+  ctx->blendRectWithMask(KDRect(30, 1, 6, 5), KDColorGreen, mask, workingBuffer);
+  ctx->blendRectWithMask(KDRect(1, 20, 6, 5), KDColorGreen, mask, workingBuffer);
+  ctx->fillRect(KDRect(20, 22, 10, 7), KDColorBlack);
+}
+
+static void assert_pixels_are_equal(const KDColor * pixels1, const KDColor * pixels2) {
+  for (int i = 0; i < k_width*k_height; i++) {
+    assert(pixels1[i] == pixels2[i]);
+  }
+}
+
+QUIZ_CASE(kandinsky_tile_context_draws_like_display) {
+  static KDColor expectedPixels[k_width*k_height];
+  fill_with_pattern(expectedPixels);
+  KDFrameBuffer expectedFrameBuffer(expectedPixels, KDSize(k_width, k_height));
+  KDFrameBufferContext expectedContext(&expectedFrameBuffer);
+  draw(&expectedContext);
+
+  static KDColor pixels[k_width*k_height];
+  static KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  static FrameBufferTileContext tileContext(&frameBuffer);
+  constexpr int numberOfTileHeights = 2;
+  KDCoordinate tileHeights[numberOfTileHeights] = {k_height, 7};
+  for (int i = 0; i < numberOfTileHeights; i++) {
+    KDCoordinate tileHeight = tileHeights[i];
+    fill_with_pattern(pixels);
+    tileContext.resetCounters();
+    for (KDCoordinate top = 0; top < k_height; top += tileHeight) {
+      tileContext.setTile(KDRect(0, top, k_width, tileHeight));
+      draw(&tileContext);
+      tileContext.flush();
+    }
+    assert_pixels_are_equal(pixels, expectedPixels);
+    // The pixels between the drawings are pulled to be pushed back unchanged
+    assert(tileContext.numberOfPulledPixels() > 0);
+  }
+}
+
+QUIZ_CASE(kandinsky_tile_context_pushes_each_pixel_once) {
+  static KDColor pixels[k_width*k_height];
+  static KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  static FrameBufferTileContext tileContext(&frameBuffer);
+  fill_with_pattern(pixels);
+  tileContext.resetCounters();
+  tileContext.setTile(KDRect(0, 0, k_width, k_height));
+  tileContext.fillRect(KDRect(0, 0, 20, 16), KDColorWhite);
+  tileContext.fillRect(KDRect(2, 2, 16, 6), KDColorRed);
+  tileContext.drawString("1", KDPoint(4, 1), KDText::FontSize::Small, KDColorBlack, KDColorRed);
+  tileContext.flush();
+  assert(tileContext.numberOfPushedPixels() == 20*16);
+  assert(tileContext.numberOfPulledPixels() == 0);
+  assert(pixels[0] == KDColorWhite);
+  assert(pixels[2*k_width+2] == KDColorRed);
+  assert(pixels[16*k_width] == KDColor::RGB16(16*k_width*37));
+}
@@ -6,6 +6,7 @@
 #include <poincare/absolute_value.h>
 #include <poincare/addition.h>
 #include <poincare/approximation.h>
+#include <poincare/approximation_program.h>
 #include <poincare/arc_cosine.h>
 #include <poincare/arc_sine.h>
 #include <poincare/arc_tangent.h>
@@ -20,6 +21,7 @@
 #include <poincare/derivative.h>
 #include <poincare/determinant.h>
 #include <poincare/division.h>
+#include <poincare/dual_number.h>
 #include <poincare/division_quotient.h>
 #include <poincare/division_remainder.h>
 #include <poincare/empty_expression.h>
@@ -44,6 +46,7 @@
 #include <poincare/imaginary_part.h>
 #include <poincare/integral.h>
 #include <poincare/least_common_multiple.h>
+#include <poincare/linear_algebra.h>
 #include <poincare/logarithm.h>
 #include <poincare/matrix.h>
 #include <poincare/matrix_dimension.h>
@@ -56,6 +59,7 @@
 #include <poincare/opposite.h>
 #include <poincare/parenthesis.h>
 #include <poincare/permute_coefficient.h>
+#include <poincare/polynomial.h>
 #include <poincare/power.h>
 #include <poincare/prediction_interval.h>
 #include <poincare/preferences.h>
@@ -63,8 +67,10 @@
 #include <poincare/randint.h>
 #include <poincare/random.h>
 #include <poincare/rational.h>
+#include <poincare/real_interval.h>
 #include <poincare/real_part.h>
 #include <poincare/round.h>
+#include <poincare/simplification_cache.h>
 #include <poincare/sine.h>
 #include <poincare/square_root.h>
 #include <poincare/store.h>
@@ -13,6 +13,7 @@ public:
   Type type() const override;
   Expression * clone() const override;
   Sign sign() const override { return Sign::Positive; }
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, AngleUnit angleUnit);
 private:
   Expression * setSign(Sign s, Context & context, AngleUnit angleUnit) override;
   /* Layout */
@@ -22,14 +23,16 @@ private:
   }
   /* Simplification */
   Expression * shallowReduce(Context& context, AngleUnit angleUnit) override;
+  Expression * createDerivative(char symbol, AngleUnit angleUnit) const override;
   /* Evaluation */
-  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, AngleUnit angleUnit);
   Evaluation<float> * privateApproximate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override {
     return ApproximationEngine::map<float>(this, context, angleUnit, computeOnComplex<float>);
   }
   Evaluation<double> * privateApproximate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override {
   return ApproximationEngine::map<double>(this, context, angleUnit, computeOnComplex<double>);
   }
+  RealInterval privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const override;
+  DualNumber privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const override;
 };
 
 }
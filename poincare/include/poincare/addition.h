@@ -23,10 +23,10 @@ public:
   int privateGetPolynomialCoefficients(char symbolName, Expression * coefficients[]) const override;
   /* Evaluation */
   template<typename T> static std::complex<T> compute(const std::complex<T> c, const std::complex<T> d);
-  template<typename T> static MatrixComplex<T> computeOnMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n) {
+  template<typename T> static MatrixComplex<T> computeOnMatrices(const MatrixComplex<T> & m, const MatrixComplex<T> & n) {
     return ApproximationEngine::elementWiseOnComplexMatrices(m, n, compute<T>);
   }
-  template<typename T> static MatrixComplex<T> computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> m) {
+  template<typename T> static MatrixComplex<T> computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> & m) {
     return ApproximationEngine::elementWiseOnMatrixComplexAndComplex(m, c, compute<T>);
   }
 private:
@@ -42,13 +42,14 @@ private:
 
   /* Simplification */
   Expression * shallowReduce(Context& context, AngleUnit angleUnit) override;
+  Expression * createDerivative(char symbol, AngleUnit angleUnit) const override;
   Expression * shallowBeautify(Context & context, AngleUnit angleUnit) override;
   Expression * factorizeOnCommonDenominator(Context & context, AngleUnit angleUnit);
   void factorizeOperands(Expression * e1, Expression * e2, Context & context, AngleUnit angleUnit);
   static const Rational RationalFactor(Expression * e);
   static bool TermsHaveIdenticalNonRationalFactors(const Expression * e1, const Expression * e2);
   /* Evaluation */
-  template<typename T> static MatrixComplex<T> computeOnMatrixAndComplex(const MatrixComplex<T> m, const std::complex<T> c) {
+  template<typename T> static MatrixComplex<T> computeOnMatrixAndComplex(const MatrixComplex<T> & m, const std::complex<T> c) {
     return ApproximationEngine::elementWiseOnMatrixComplexAndComplex(m, c, compute<T>);
   }
   Evaluation<float> * privateApproximate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override {
@@ -57,6 +58,8 @@ private:
   Evaluation<double> * privateApproximate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override {
     return ApproximationEngine::mapReduce<double>(this, context, angleUnit, compute<double>, computeOnComplexAndMatrix<double>, computeOnMatrixAndComplex<double>, computeOnMatrices<double>);
    }
+  RealInterval privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const override;
+  DualNumber privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const override;
 };
 
 }
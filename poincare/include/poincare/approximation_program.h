@@ -0,0 +1,93 @@
+#ifndef POINCARE_APPROXIMATION_PROGRAM_H
+#define POINCARE_APPROXIMATION_PROGRAM_H
+
+#include <poincare/approximation_engine.h>
+#include <poincare/expression.h>
+#include <complex>
+
+namespace Poincare {
+
+/* An ApproximationProgram is an expression compiled into a flat postfix
+ * program on complex scalars, to approximate it for many values of a symbol.
+ * Running the program neither walks the expression tree nor allocates any
+ * Evaluation: it calls the same complex kernels as the tree approximation,
+ * on a small stack. Constant subtrees are approximated once at compilation;
+ * variables stored in the context are read at each run as they may change
+ * between two runs.
+ * Expressions involving matrices or nodes without complex kernel (sum,
+ * integral...) cannot be compiled: the program then falls back on the tree
+ * approximation. */
+
+template<typename T>
+class ApproximationProgram {
+public:
+  ApproximationProgram();
+  ApproximationProgram(const Expression * expression, char symbol, Context & context, Expression::AngleUnit angleUnit);
+  ~ApproximationProgram();
+  ApproximationProgram(const ApproximationProgram& other) = delete;
+  ApproximationProgram& operator=(const ApproximationProgram& other) = delete;
+  /* The expression is not owned by the program and has to outlive it, or at
+   * least to outlive the next call to compile or reset. */
+  void compile(const Expression * expression, char symbol, Context & context, Expression::AngleUnit angleUnit);
+  void reset();
+  const Expression * expression() const { return m_expression; }
+  Expression::AngleUnit angleUnit() const { return m_angleUnit; }
+  bool isCompiled() const { return m_numberOfInstructions > 0; }
+  T approximateWithValueForSymbol(T x, Context & context) const;
+  /* Approximate the expression for n values of the symbol. The values are
+   * processed by batches, each instruction running as a loop over a batch. */
+  void approximateWithValuesForSymbol(const T * x, T * y, int n, Context & context) const;
+private:
+  constexpr static int k_maxNumberOfInstructions = 128;
+  constexpr static int k_maxNumberOfConstants = 32;
+  constexpr static int k_maxStackDepth = 16;
+  constexpr static int k_batchSize = 8;
+  /* Opposite, Addition, Subtraction and Multiplication carry their kernel like
+   * Unary and Binary, but are identified to be run component-wise on batches. */
+  enum class Opcode : uint8_t {
+    PushConstant,
+    PushSymbol,
+    PushVariable,
+    Opposite,
+    Addition,
+    Subtraction,
+    Multiplication,
+    Unary,
+    Binary
+  };
+  struct Instruction {
+    Opcode opcode;
+    union {
+      int constantIndex;
+      const Expression * variable;
+      ApproximationEngine::ComplexCompute<T> unary;
+      ApproximationEngine::ComplexAndComplexReduction<T> binary;
+    };
+  };
+  struct Compilation {
+    Instruction instructions[k_maxNumberOfInstructions];
+    std::complex<T> constants[k_maxNumberOfConstants];
+    int numberOfInstructions;
+    int numberOfConstants;
+    int stackDepth;
+  };
+  void approximateBatch(const T * x, T * y, int n, Context & context) const;
+  bool compileExpression(const Expression * e, Context & context, Compilation * compilation) const;
+  bool isConstant(const Expression * e) const;
+  static bool emit(Compilation * compilation, Instruction instruction, int stackVariation);
+  static ApproximationEngine::ComplexCompute<T> UnaryKernel(Expression::Type type);
+  static ApproximationEngine::ComplexAndComplexReduction<T> BinaryKernel(Expression::Type type);
+  static Opcode BinaryOpcode(Expression::Type type);
+  static void ApproximateBinaryOnBatch(ApproximationEngine::ComplexAndComplexReduction<T> kernel, T * real, T * imag, const T * otherReal, const T * otherImag, int n);
+  static void NormalizeZeros(T * lane, int n);
+  const Expression * m_expression;
+  Instruction * m_instructions;
+  std::complex<T> * m_constants;
+  int m_numberOfInstructions;
+  char m_symbol;
+  Expression::AngleUnit m_angleUnit;
+};
+
+}
+
+#endif
@@ -13,6 +13,7 @@ class ArcTangent : public StaticHierarchy<1>  {
 public:
   Type type() const override;
   Expression * clone() const override;
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, AngleUnit angleUnit);
 private:
   /* Layout */
   ExpressionLayout * createLayout(PrintFloat::Mode floatDisplayMode, int numberOfSignificantDigits) const override {
@@ -24,8 +25,8 @@ private:
   const char * name() const { return "atan"; }
   /* Simplification */
   Expression * shallowReduce(Context& context, AngleUnit angleUnit) override;
+  Expression * createDerivative(char symbol, AngleUnit angleUnit) const override;
   /* Evaluation */
-  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, AngleUnit angleUnit);
   Evaluation<float> * privateApproximate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override {
     return ApproximationEngine::map<float>(this, context, angleUnit,computeOnComplex<float>);
   }
@@ -13,10 +13,33 @@ public:
   static void PrimeFactorization(const Integer * i, Integer * outputFactors, Integer * outputCoefficients, int outputLength);
   constexpr static int k_numberOfPrimeFactors = 1000;
   constexpr static int k_maxNumberOfPrimeFactors = 32;
+  /* When decomposing an integer into prime factors, we first look for its
+   * prime factors in the table primeFactors. The remaining cofactor is then
+   * split with Pollard-Brent's rho method as long as it has at most
+   * k_maxNumberOfDigitsToFactorize digits. */
+  constexpr static int k_maxNumberOfDigitsToFactorize = 8;
 private:
-  /* When decomposing an integer into primes factors, we look for its prime
-   * factors among integer from 2 to 10000. */
-  constexpr static int k_biggestPrimeFactor = 10000;
+  /* Pollard-Brent's rho method gives up once the factorization has cost
+   * k_maxFactorizationWork, a rho iteration on an n-digit number costing n^2
+   * like the Montgomery multiplications it performs. This is 2^18 iterations
+   * on the 3-digit products of two 10-digit primes, and bounds the time
+   * during which a reduction blocks the UI whatever the size of the number.
+   * The factorization also stops with the processing of the expression. */
+  constexpr static int k_maxFactorizationWork = 9 << 18;
+  constexpr static int k_rhoGCDPeriod = 128;
+  /* The Miller-Rabin test with the first k_numberOfMillerRabinBases primes as
+   * bases is deterministic below 3317044064679887385961981. Above that bound,
+   * a number that passes the test is only probably prime. */
+  constexpr static int k_numberOfMillerRabinBases = 13;
+  enum class Primality {
+    Composite,
+    Prime,
+    ProbablePrime
+  };
+  static Primality PrimalityOf(const Integer & i);
+  static Integer PollardRhoFactor(const Integer & n, int * remainingWork);
+  static Integer::native_uint_t Remainder(const Integer & a, Integer::half_native_uint_t b);
+  static Integer IntegerWithDigits(const Integer::native_uint_t * digits, int numberOfDigits);
 };
 
 }
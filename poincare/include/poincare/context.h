@@ -6,10 +6,15 @@
 
 namespace Poincare {
 
+class SimplificationCache;
+
 class Context {
 public:
   virtual const Expression * expressionForSymbol(const Symbol * symbol) = 0;
   virtual void setExpressionForSymbolName(const Expression * expression, const Symbol * symbol, Context & context) = 0;
+  /* The cache memoizing Expression::ParseAndSimplify in this context, if any.
+   * It has to be invalidated whenever a symbol value changes. */
+  virtual SimplificationCache * simplificationCache() { return nullptr; }
 };
 
 }
@@ -28,6 +28,7 @@ private:
   const char * name() const { return "cos"; }
   /* Simplication */
   Expression * shallowReduce(Context& context, AngleUnit angleUnit) override;
+  Expression * createDerivative(char symbol, AngleUnit angleUnit) const override;
   /* Evaluation */
   Evaluation<float> * privateApproximate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override {
     return ApproximationEngine::map<float>(this, context, angleUnit,computeOnComplex<float>);
@@ -35,6 +36,8 @@ private:
   Evaluation<double> * privateApproximate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override {
     return ApproximationEngine::map<double>(this, context, angleUnit, computeOnComplex<double>);
   }
+  RealInterval privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const override;
+  DualNumber privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const override;
 };
 
 }
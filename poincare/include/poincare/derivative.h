@@ -4,6 +4,7 @@
 #include <poincare/layout_engine.h>
 #include <poincare/static_hierarchy.h>
 #include <poincare/variable_context.h>
+#include <poincare/approximation_program.h>
 
 namespace Poincare {
 
@@ -28,8 +29,8 @@ private:
   Evaluation<float> * privateApproximate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedApproximate<float>(context, angleUnit); }
   Evaluation<double> * privateApproximate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedApproximate<double>(context, angleUnit); }
   template<typename T> Complex<T> * templatedApproximate(Context& context, AngleUnit angleUnit) const;
-  template<typename T> T growthRateAroundAbscissa(T x, T h, Context & context, AngleUnit angleUnit) const;
-  template<typename T> T riddersApproximation(Context & context, AngleUnit angleUnit, T x, T h, T * error) const;
+  template<typename T> T growthRateAroundAbscissa(T x, T h, const ApproximationProgram<T> & function, Context & context) const;
+  template<typename T> T riddersApproximation(const ApproximationProgram<T> & function, Context & context, T x, T h, T * error) const;
   // TODO: Change coefficients?
   constexpr static double k_maxErrorRateOnApproximation = 0.001;
   constexpr static double k_minInitialRate = 0.01;
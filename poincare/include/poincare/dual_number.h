@@ -0,0 +1,46 @@
+#ifndef POINCARE_DUAL_NUMBER_H
+#define POINCARE_DUAL_NUMBER_H
+
+#include <complex>
+#include <cmath>
+
+namespace Poincare {
+
+/* A DualNumber holds the approximation of an expression together with its
+ * derivative with respect to a symbol. Propagating dual numbers through the
+ * expression differentiates it exactly in a single evaluation (forward-mode
+ * automatic differentiation). Elementary functions are holomorphic away from
+ * their branch cuts, so values and derivatives are complex.
+ * A NAN derivative stands for an expression that is not differentiable this
+ * way (floor, random...): the derivative then has to be approximated
+ * numerically. An infinite derivative stands for an expression that is not
+ * differentiable at this point (abs on 0...): its derivative is undefined. */
+
+class DualNumber {
+public:
+  DualNumber(std::complex<double> value, std::complex<double> derivative) : m_value(value), m_derivative(derivative) {}
+  static DualNumber Undifferentiable() { return DualNumber(NAN, NAN); }
+  static DualNumber Singular(std::complex<double> value) { return DualNumber(value, INFINITY); }
+  static DualNumber Constant(std::complex<double> value) { return DualNumber(value, 0.0); }
+  static DualNumber Variable(double value) { return DualNumber(value, 1.0); }
+  std::complex<double> value() const { return m_value; }
+  std::complex<double> derivative() const { return m_derivative; }
+  bool isDifferentiable() const { return std::isfinite(m_derivative.real()) && std::isfinite(m_derivative.imag()); }
+  bool isSingular() const { return std::isinf(m_derivative.real()); }
+  bool isConstant() const { return m_derivative == std::complex<double>(0.0); }
+
+  static DualNumber Opposite(DualNumber a);
+  static DualNumber Addition(DualNumber a, DualNumber b);
+  static DualNumber Subtraction(DualNumber a, DualNumber b);
+  static DualNumber Multiplication(DualNumber a, DualNumber b);
+  static DualNumber Division(DualNumber a, DualNumber b);
+  /* Chain rule: f(a) where f(a.value) = value and f'(a.value) = derivative */
+  static DualNumber Composition(DualNumber a, std::complex<double> value, std::complex<double> derivative);
+private:
+  std::complex<double> m_value;
+  std::complex<double> m_derivative;
+};
+
+}
+
+#endif
@@ -35,8 +35,10 @@ protected:
   int m_numberOfOperands;
 private:
   void removeOperandAtIndex(int i, bool deleteAfterRemoval);
+  static void MergeOperands(const Expression ** source, const Expression ** destination, int start, int middle, int end, ExpressionOrder order, bool canBeInterrupted);
   int simplificationOrderSameType(const Expression * e, bool canBeInterrupted) const override;
   int simplificationOrderGreaterType(const Expression * e, bool canBeInterrupted) const override;
+  uint32_t computeHash() const override;
 };
 
 }
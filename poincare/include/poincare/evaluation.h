@@ -5,6 +5,7 @@
 extern "C" {
 #include <stdint.h>
 }
+#include <poincare/evaluation_arena.h>
 #include <poincare/expression.h>
 
 namespace Poincare {
@@ -16,6 +17,8 @@ public:
     Complex,
     MatrixComplex
   };
+  static void * operator new(size_t size) { return EvaluationArena::Allocate(size); }
+  static void operator delete(void * block, size_t size) { EvaluationArena::Release(block, size); }
   virtual Type type() const = 0;
   virtual ~Evaluation() {}
   virtual bool isUndefined() const = 0;
@@ -71,6 +74,7 @@ public:
 
   typename Poincare::Evaluation<T>::Type type() const override { return Poincare::Evaluation<T>::Type::MatrixComplex; }
   const std::complex<T> complexOperand(int i) const { return m_operands[i]; }
+  const std::complex<T> * complexOperands() const { return m_operands; }
   int numberOfComplexOperands() const { return m_numberOfRows*m_numberOfColumns; }
   int numberOfRows() const { return m_numberOfRows; }
   int numberOfColumns() const { return m_numberOfColumns; }
@@ -84,9 +88,16 @@ public:
   MatrixComplex<T> * createTranspose() const override;
   static MatrixComplex<T> createIdentity(int dim);
 private:
+  /* Small matrices keep their operands inline to avoid an allocation for
+   * every intermediate result. */
+  constexpr static int k_maxNumberOfInlineOperands = 4;
+  bool usesInlineOperands() const { return m_operands == m_inlineOperands; }
+  void allocateOperands(int numberOfOperands);
+  void pilferOperands(MatrixComplex & other);
   std::complex<T> * m_operands;
   int m_numberOfRows;
   int m_numberOfColumns;
+  std::complex<T> m_inlineOperands[k_maxNumberOfInlineOperands];
 };
 
 }
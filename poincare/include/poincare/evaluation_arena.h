@@ -0,0 +1,44 @@
+#ifndef POINCARE_EVALUATION_ARENA_H
+#define POINCARE_EVALUATION_ARENA_H
+
+#include <stddef.h>
+
+namespace Poincare {
+
+/* The EvaluationArena provides the memory of the Evaluations created while
+ * approximating an expression. Evaluations are allocated by bumping an offset
+ * in a static buffer and deleting them only gives back their memory if they
+ * are the last allocated block: the whole arena is released at the end of the
+ * approximation.
+ * Evaluations are taken from the arena only within an EvaluationArena::Scope,
+ * and every Evaluation created within a scope has to be deleted before the
+ * scope ends. Outside of any scope or once the arena is full, Evaluations are
+ * allocated on the heap. */
+
+class EvaluationArena {
+public:
+  class Scope {
+  public:
+    Scope();
+    ~Scope();
+    Scope(const Scope & other) = delete;
+    Scope & operator=(const Scope & other) = delete;
+  private:
+    size_t m_offset;
+  };
+  static void * Allocate(size_t size);
+  static void Release(void * block, size_t size);
+  static size_t Offset() { return s_offset; }
+private:
+  constexpr static size_t k_size = 2048;
+  constexpr static size_t k_alignment = 8;
+  static size_t AlignedSize(size_t size) { return (size + k_alignment - 1) & ~(k_alignment - 1); }
+  static bool Contains(const void * block);
+  alignas(k_alignment) static char s_buffer[k_size];
+  static size_t s_offset;
+  static int s_depth;
+};
+
+}
+
+#endif
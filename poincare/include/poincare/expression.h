@@ -3,9 +3,12 @@
 
 #include <poincare/expression_layout.h>
 #include <poincare/print_float.h>
+#include <poincare/real_interval.h>
+#include <poincare/dual_number.h>
 #include <complex>
 extern "C" {
 #include <assert.h>
+#include <stdint.h>
 }
 
 namespace Poincare {
@@ -78,6 +81,7 @@ class Expression {
   friend class Sequence;
   friend class Trigonometry;
   friend class ApproximationEngine;
+  template<typename T> friend class ApproximationProgram;
   friend class SimplificationEngine;
   friend class LayoutEngine;
   friend class EmptyExpression;
@@ -170,6 +174,10 @@ public:
   /* Circuit breaker */
   typedef bool (*CircuitBreaker)();
   static void setCircuitBreaker(CircuitBreaker cb);
+  /* A processing deadline stops the processing once the delay has elapsed,
+   * in addition to the circuit breaker. */
+  static void setProcessingDeadline(uint64_t delayInMilliseconds);
+  static void clearProcessingDeadline();
   static bool shouldStopProcessing();
 
   /* Hierarchy */
@@ -240,10 +248,17 @@ public:
    * same structures and all their nodes have same types and values (ie,
    * sqrt(pi^2) is NOT identical to pi). */
   bool isIdenticalTo(const Expression * e) const {
+    // Identical trees have the same hash
+    if (hash() != e->hash()) {
+      return false;
+    }
     /* We use the simplification order only because it is a already-coded total
      * order on expresssions. */
     return SimplificationOrder(this, e, true) == 0;
   }
+  /* hash is a structural hash of the tree, computed once and cached in each
+   * node until the node or one of its descendants is modified. */
+  uint32_t hash() const;
   bool isEqualToItsApproximationLayout(Expression * approximation, int bufferSize, AngleUnit angleUnit, PrintFloat::Mode floatDisplayMode, int numberOfSignificantDigits, Context & context);
 
   /* Layout Engine */
@@ -262,6 +277,10 @@ public:
   template<typename T> T approximateToScalar(Context& context, AngleUnit angleUnit) const;
   template<typename T> static T approximateToScalar(const char * text, Context& context, AngleUnit angleUnit);
   template<typename T> T approximateWithValueForSymbol(char symbol, T x, Context & context, AngleUnit angleUnit) const;
+  /* approximateIntervalForSymbol returns an enclosure of the real values of
+   * the expression (as approximated by approximateWithValueForSymbol) when the
+   * symbol ranges over [lower, upper]. */
+  RealInterval approximateIntervalForSymbol(char symbol, double lower, double upper, Context & context, AngleUnit angleUnit) const;
 
   /* Expression roots/extrema solver*/
   struct Coordinate2D {
@@ -277,9 +296,14 @@ public:
   template<typename T> static T epsilon();
 protected:
   /* Constructor */
-  Expression() : m_parent(nullptr) {}
+  Expression() : m_parent(nullptr), m_hash(0) {}
   /* Hierarchy */
   void detachOperandAtIndex(int i);
+  /* Comparison */
+  /* invalidateHash has to be called whenever the node is modified: it discards
+   * the cached hashes of the node and of its ancestors. */
+  void invalidateHash();
+  static uint32_t CombineHash(uint32_t hash, uint32_t value);
   /* Evaluation Engine */
   typedef float SinglePrecision;
   typedef double DoublePrecision;
@@ -314,6 +338,9 @@ private:
   virtual int simplificationOrderGreaterType(const Expression * e, bool canBeInterrupted) const { return -1; }
   //TODO: What should be the implementation for complex?
   virtual int simplificationOrderSameType(const Expression * e, bool canBeInterrupted) const { return 0; }
+  /* computeHash has to be consistent with simplificationOrderSameType: two
+   * expressions of same type whose order is 0 have the same hash. */
+  virtual uint32_t computeHash() const { return CombineHash(0, (uint32_t)type()); }
   /* Simplification */
   Expression * deepBeautify(Context & context, AngleUnit angleUnit);
   Expression * deepReduce(Context & context, AngleUnit angleUnit);
@@ -325,15 +352,31 @@ private:
   virtual Expression * cloneDenominator(Context & context, AngleUnit angleUnit) const {
     return nullptr;
   }
+  /* createDerivative returns the derivative of the expression with respect to
+   * the symbol, not reduced, or nullptr if the expression cannot be
+   * differentiated symbolically. */
+  virtual Expression * createDerivative(char symbol, AngleUnit angleUnit) const {
+    return nullptr;
+  }
   /* Evaluation Engine */
   virtual Evaluation<float> * privateApproximate(SinglePrecision p, Context& context, AngleUnit angleUnit) const = 0;
   virtual Evaluation<double> * privateApproximate(DoublePrecision p, Context& context, AngleUnit angleUnit) const = 0;
+  /* Interval approximation: by default, an expression independent of the
+   * symbol is approximated once and other expressions are unbounded. */
+  virtual RealInterval privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const;
+  /* Approximation with the derivative with respect to the symbol: by default,
+   * an expression independent of the symbol has a zero derivative and other
+   * expressions are not differentiable. */
+  virtual DualNumber privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const;
+  bool approximationDependsOnSymbol(char symbol, Context & context) const;
 
   /* Expression roots/extrema solver*/
   constexpr static double k_solverPrecision = 1.0E-5;
   constexpr static double k_sqrtEps = 1.4901161193847656E-8; // sqrt(DBL_EPSILON)
   constexpr static double k_goldenRatio = 0.381966011250105151795413165634361882279690820194237137864; // (3-sqrt(5))/2
   constexpr static double k_maxFloat = 1e100;
+  constexpr static int k_maxNumberOfSkippedSteps = 64;
+  constexpr static int k_minNumberOfSkippedSteps = 4;
   typedef double (*EvaluationAtAbscissa)(char symbol, double abscissa, Context & context, AngleUnit angleUnit, const Expression * expression0, const Expression * expression1);
   Coordinate2D nextMinimumOfExpression(char symbol, double start, double step, double max, EvaluationAtAbscissa evaluation, Context & context, AngleUnit angleUnit, const Expression * expression = nullptr, bool lookForRootMinimum = false) const;
   void bracketMinimum(char symbol, double start, double step, double max, double result[3], EvaluationAtAbscissa evaluation, Context & context, AngleUnit angleUnit, const Expression * expression = nullptr) const;
@@ -341,8 +384,14 @@ private:
   double nextIntersectionWithExpression(char symbol, double start, double step, double max, EvaluationAtAbscissa evaluation, Context & context, AngleUnit angleUnit, const Expression * expression) const;
   void bracketRoot(char symbol, double start, double step, double max, double result[2], EvaluationAtAbscissa evaluation, Context & context, AngleUnit angleUnit, const Expression * expression) const;
   double brentRoot(char symbol, double ax, double bx, double precision, EvaluationAtAbscissa evaluation, Context & context, AngleUnit angleUnit, const Expression * expression) const;
+  /* numberOfStepsAwayFromZero returns a number of steps from start over which
+   * the interval approximation of the expression (or of its difference with
+   * expression) proves that its absolute value stays above threshold. It
+   * returns 0 if no such number of steps is found. */
+  int numberOfStepsAwayFromZero(char symbol, double start, double step, double threshold, Context & context, AngleUnit angleUnit, const Expression * expression) const;
 
   Expression * m_parent;
+  mutable uint32_t m_hash; // 0 if not computed
 };
 
 }
@@ -29,7 +29,13 @@ public:
   KDPoint absoluteOrigin();
   KDSize size();
   KDCoordinate baseline();
-  virtual void invalidAllSizesPositionsAndBaselines();
+  /* Sizes, positions and baselines are computed lazily and kept until the
+   * layout is invalidated. When the children of a layout change, only the
+   * layout, its ancestors and their children need to be invalidated: the
+   * positions are relative to the parent and a layout only depends on its
+   * children and its siblings. */
+  void invalidAllSizesPositionsAndBaselines();
+  void invalidAncestorsSizesPositionsAndBaselines();
 
   /* Hierarchy */
 
@@ -133,6 +139,8 @@ protected:
   virtual KDSize computeSize() = 0;
   virtual void computeBaseline() = 0;
   virtual KDPoint positionOfChild(ExpressionLayout * child) = 0;
+  virtual void invalidSizePositionAndBaseline();
+  void setChildOrigin(ExpressionLayout * child, KDPoint origin);
   void scoreCursorInDescendantsVerticalOf (
     VerticalDirection direction,
     ExpressionLayoutCursor cursor,
@@ -153,10 +161,11 @@ protected:
   bool m_positioned;
 private:
   void detachChildAtIndex(int i);
+  void privateDraw(KDContext * ctx, KDPoint p, KDColor expressionColor, KDColor backgroundColor);
   ExpressionLayoutCursor cursorInDescendantsVerticalOf(VerticalDirection direction, ExpressionLayoutCursor cursor, bool * shouldRecomputeLayout);
   ExpressionLayout * replaceWithJuxtapositionOf(ExpressionLayout * leftChild, ExpressionLayout * rightChild, bool deleteAfterReplace);
   bool changeGreySquaresOfAllMatrixAncestors(bool add);
-  KDRect m_frame;
+  KDRect m_frame; // The origin is relative to the parent
 };
 
 }
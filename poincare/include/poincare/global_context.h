@@ -5,6 +5,7 @@
 #include <poincare/matrix.h>
 #include <poincare/approximation.h>
 #include <poincare/decimal.h>
+#include <poincare/simplification_cache.h>
 
 namespace Poincare {
 
@@ -25,6 +26,7 @@ public:
   const Expression * expressionForSymbol(const Symbol * symbol) override;
   ExpressionLayout * expressionLayoutForSymbol(const Symbol * symbol, int numberOfSignificantDigits);
   void setExpressionForSymbolName(const Expression * expression, const Symbol * symbol, Context & context) override;
+  SimplificationCache * simplificationCache() override { return &m_simplificationCache; }
   static constexpr uint16_t k_maxNumberOfScalarExpressions = 26;
   static constexpr uint16_t k_maxNumberOfListExpressions = 10;
   static constexpr uint16_t k_maxNumberOfMatrixExpressions = 10;
@@ -38,6 +40,7 @@ private:
   Approximation<double> m_pi;
   Approximation<double> m_e;
   Approximation<double> m_i;
+  SimplificationCache m_simplificationCache;
 };
 
 }
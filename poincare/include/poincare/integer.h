@@ -14,6 +14,7 @@ class ExpressionLayout;
 struct IntegerDivision;
 
 class Integer {
+  friend class Arithmetic;
 public:
   typedef uint16_t half_native_uint_t;
   typedef int32_t native_int_t;
@@ -49,6 +50,7 @@ public:
   static int NaturalOrder(const Integer & i, const Integer & j);
   bool isEqualTo(const Integer & other) const;
   bool isLowerThan(const Integer & other) const;
+  uint32_t hash() const;
 
   // Layout
   int writeTextInBuffer(char * buffer, int bufferSize) const;
@@ -82,7 +84,13 @@ private:
   static Integer usum(const Integer & a, const Integer & b, bool subtract, bool outputNegative);
   static Integer addition(const Integer & a, const Integer & b, bool inverseBNegative);
   static IntegerDivision udiv(const Integer & a, const Integer & b);
+  static void umul(const native_uint_t * a, uint16_t aSize, const native_uint_t * b, uint16_t bSize, native_uint_t * product);
+  static Integer parseDigits(const char * digits, int length);
+  static int writeDigits(const Integer & i, char * buffer, int bufferSize);
+  static Integer ugcd(const Integer & a, const Integer & b);
+  static native_int_t leadingBits(const Integer & i, int shift);
   bool usesImmediateDigit() const { return m_numberOfDigits == 1; }
+  const native_uint_t * digits() const { return usesImmediateDigit() ? &m_digit : m_digits; }
   native_uint_t digit(int i) const {
     assert(i >= 0 && i < m_numberOfDigits);
     return (usesImmediateDigit() ? m_digit : m_digits[i]);
@@ -107,6 +115,23 @@ private:
   uint16_t m_numberOfDigits; // In base native_uint_max
   bool m_negative; // Make sure zero cannot be negative
 
+  /* Under this number of digits, the schoolbook multiplication is faster than
+   * Karatsuba's algorithm. */
+  constexpr static uint16_t k_karatsubaThreshold = 32;
+  /* Radix conversions process the decimal digits by chunks. When parsing, a
+   * chunk of 9 decimal digits fits in a native digit. When writing, we divide
+   * by 10^4 half native digit by half native digit, so that each step only
+   * involves native (and not double native) divisions. */
+  constexpr static int k_numberOfDecimalDigitsInNativeDigit = 9;
+  constexpr static int k_numberOfDecimalDigitsInHalfNativeDigit = 4;
+  constexpr static half_native_uint_t k_halfNativeDigitDecimalBase = 10000;
+  /* ugcd uses Lehmer's algorithm while both operands have at least
+   * k_lehmerThreshold digits, and Stein's binary algorithm below. Lehmer's
+   * algorithm simulates the Euclidean steps on the k_lehmerNumberOfBits
+   * leading bits of the operands. */
+  constexpr static uint16_t k_lehmerThreshold = 3;
+  constexpr static int k_lehmerNumberOfBits = 30;
+
   static_assert(sizeof(native_int_t) <= sizeof(native_uint_t), "native_uint_t should be able to contain native_int_t data");
   static_assert(sizeof(double_native_uint_t) == 2*sizeof(native_uint_t), "double_native_uint_t should be twice the size of native_uint_t");
 };
@@ -3,6 +3,7 @@
 
 #include <poincare/static_hierarchy.h>
 #include <poincare/variable_context.h>
+#include <poincare/approximation_program.h>
 #include <poincare/layout_engine.h>
 
 namespace Poincare {
@@ -31,14 +32,28 @@ private:
     T integral;
     T absoluteError;
   };
+  template<typename T>
+  struct Subinterval
+  {
+    T a;
+    T b;
+    DetailedResult<T> quadrature;
+    int depth;
+  };
   constexpr static int k_maxNumberOfIterations = 10;
 #ifdef LAGRANGE_METHOD
-  template<typename T> T lagrangeGaussQuadrature(T a, T b, Context & context, AngleUnit angleUnit) const;
+  template<typename T> T lagrangeGaussQuadrature(T a, T b, const ApproximationProgram<T> & function, Context & context) const;
 #else
-  template<typename T> DetailedResult<T> kronrodGaussQuadrature(T a, T b, Context & context, AngleUnit angleUnit) const;
-  template<typename T> T adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, Context & context, AngleUnit angleUnit) const;
+  constexpr static int k_numberOfKronrodAbscissae = 21;
+  /* The subintervals of the adaptive quadrature are kept on the stack: 32
+   * double subintervals take 1280 bytes. */
+  constexpr static int k_maxNumberOfSubintervals = 32;
+  /* kronrodAbscissae fills the 21 abscissae of the quadrature on [a,b], which
+   * kronrodGaussQuadrature expects the evaluations at in the same order. */
+  template<typename T> void kronrodAbscissae(T a, T b, T * abscissae) const;
+  template<typename T> DetailedResult<T> kronrodGaussQuadrature(T a, T b, const T * evaluations) const;
+  template<typename T> T adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, const ApproximationProgram<T> & function, Context & context) const;
 #endif
-  template<typename T> T functionValueAtAbscissa(T x, Context & xcontext, AngleUnit angleUnit) const;
 };
 
 }
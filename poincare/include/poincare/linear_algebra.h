@@ -0,0 +1,48 @@
+#ifndef POINCARE_LINEAR_ALGEBRA_H
+#define POINCARE_LINEAR_ALGEBRA_H
+
+#include <complex>
+
+namespace Poincare {
+
+/* LinearAlgebra gathers the numeric kernels on row-major arrays used to
+ * approximate matrices. T is float, double or their complex versions; complex
+ * matrices whose imaginary parts are all null are processed with the real
+ * kernels. */
+
+class LinearAlgebra {
+public:
+  // result = a*b, with a of size m*n and b of size n*p
+  template<typename T> static void Multiply(const T * a, const T * b, T * result, int m, int n, int p);
+  template<typename T> static void Multiply(const std::complex<T> * a, const std::complex<T> * b, std::complex<T> * result, int m, int n, int p);
+  /* Inverse the square matrix a in place. Returns -1 if a is not square, -2 if
+   * a is singular and 0 otherwise. */
+  template<typename T> static int Inverse(T * a, int numberOfRows, int numberOfColumns);
+  template<typename T> static int Inverse(std::complex<T> * a, int numberOfRows, int numberOfColumns);
+  // The determinant of the square matrix a, which is overwritten
+  template<typename T> static T Determinant(T * a, int dim);
+  template<typename T> static std::complex<T> Determinant(std::complex<T> * a, int dim);
+  // result = a^n, with n >= 0
+  template<typename T> static void Power(const T * a, int dim, int n, T * result);
+  template<typename T> static void Power(const std::complex<T> * a, int dim, int n, std::complex<T> * result);
+private:
+  /* Blocks of k_blockSize columns of b stay in cache while being multiplied
+   * by a block of rows of a. */
+  constexpr static int k_blockSize = 16;
+  template<typename T> static void MultiplyKernel(const T * a, const T * b, T * result, int m, int n, int p);
+  /* In-place LU decomposition with partial pivoting: a = P*L*U where L has a
+   * unit diagonal. Returns the sign of the permutation P, or 0 if a is
+   * singular. */
+  template<typename T> static int LUDecompose(T * a, int dim, int * permutation);
+  template<typename T> static int InverseKernel(T * a, int dim);
+  template<typename T> static T DeterminantKernel(T * a, int dim);
+  template<typename T> static void PowerKernel(const T * a, int dim, int n, T * result);
+  template<typename T> static void Identity(T * a, int dim);
+  template<typename T> static bool IsReal(const std::complex<T> * a, int numberOfOperands);
+  template<typename T> static T * CreateRealParts(const std::complex<T> * a, int numberOfOperands);
+  template<typename T> static void CopyRealParts(const T * a, std::complex<T> * result, int numberOfOperands);
+};
+
+}
+
+#endif
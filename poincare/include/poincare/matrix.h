@@ -39,8 +39,10 @@ public:
 private:
   /* rowCanonize turns a matrix in its reduced row echelon form. */
   void rowCanonize(Context & context, AngleUnit angleUnit, Multiplication * m = nullptr);
-  // Row canonize the array in place
-  template<typename T> static void ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * c = nullptr);
+  /* rowCanonizeRationals row canonizes a matrix of rationals with the
+   * fraction-free Bareiss elimination on integers. It returns false if an
+   * operand is not a rational. */
+  bool rowCanonizeRationals(Multiplication * determinant);
   /* Layout */
   ExpressionLayout * createLayout(PrintFloat::Mode floatDisplayMode, int numberOfSignificantDigits) const override;
   /* Evaluation */
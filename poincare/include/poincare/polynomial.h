@@ -0,0 +1,92 @@
+#ifndef POINCARE_POLYNOMIAL_H
+#define POINCARE_POLYNOMIAL_H
+
+#include <poincare/integer.h>
+#include <poincare/expression.h>
+
+namespace Poincare {
+
+struct PolynomialDivision;
+
+/* A Polynomial is a sparse polynomial with rational coefficients in at most
+ * k_maxNumberOfVariables symbols. It lets the reducer expand powers and
+ * products of sums without building and reducing intermediate expressions.
+ * Terms are sorted by increasing exponents, in the lexicographic order of the
+ * variables, which are themselves sorted by name. */
+
+class Polynomial {
+public:
+  constexpr static int k_maxNumberOfVariables = Expression::k_maxNumberOfVariables;
+  constexpr static int k_maxDegree = 255;
+  /* Conversions of expressions give up above k_maxNumberOfTerms terms or
+   * k_maxNumberOfProducts products of terms. */
+  constexpr static int k_maxNumberOfTerms = 100;
+  constexpr static int k_maxNumberOfProducts = 1024;
+
+  Polynomial(); // The zero polynomial
+  Polynomial(const Integer & numerator, const Integer & denominator = Integer(1));
+  static Polynomial Variable(char name);
+  ~Polynomial();
+  Polynomial(const Polynomial & other);
+  Polynomial(Polynomial && other);
+  Polynomial & operator=(const Polynomial & other);
+  Polynomial & operator=(Polynomial && other);
+
+  /* FromExpression converts a reduced expression built of rationals, symbols,
+   * additions, multiplications and powers with natural exponents. It returns
+   * false if the expression is not such a polynomial or if it is too large. */
+  static bool FromExpression(const Expression * e, Polynomial * result);
+  /* createExpression returns an expression that still has to be reduced */
+  Expression * createExpression() const;
+  static bool IsVariable(const Expression * e);
+
+  int numberOfTerms() const { return m_numberOfTerms; }
+  bool isZero() const { return m_numberOfTerms == 0; }
+  int degree(char variable) const;
+  bool isUnivariate() const;
+
+  static Polynomial Addition(const Polynomial & a, const Polynomial & b);
+  static Polynomial Subtraction(const Polynomial & a, const Polynomial & b);
+  static Polynomial Multiplication(const Polynomial & a, const Polynomial & b);
+  static Polynomial Power(const Polynomial & a, int n);
+  /* Division and GCD are only defined on polynomials in the same variable.
+   * The GCD is monic. */
+  static PolynomialDivision Division(const Polynomial & numerator, const Polynomial & denominator);
+  static Polynomial GCD(const Polynomial & a, const Polynomial & b);
+  /* The operations assume that their result has at most
+   * k_maxNumberOfVariables variables. */
+  static bool CanAdd(const Polynomial & a, const Polynomial & b);
+  static bool CanMultiply(const Polynomial & a, const Polynomial & b);
+  static bool CanPower(const Polynomial & a, int n);
+private:
+  struct Term {
+    Integer numerator;
+    Integer denominator;
+    uint8_t exponents[k_maxNumberOfVariables];
+  };
+  void allocateTerms(int numberOfTerms);
+  void copyVariables(const Polynomial & other);
+  int variableIndex(char name) const;
+  /* Unify rewrites a and b on the union of their variables, which keeps their
+   * terms sorted. */
+  static int NumberOfUnifiedVariables(const Polynomial & a, const Polynomial & b);
+  static void Unify(const Polynomial & a, const Polynomial & b, Polynomial * unifiedA, Polynomial * unifiedB);
+  static Polynomial WithVariables(const Polynomial & p, const char * variables, int numberOfVariables);
+  static int CompareExponents(const Term & t1, const Term & t2, int numberOfVariables);
+  static void MultiplyCoefficients(const Term & t1, const Term & t2, Term * result);
+  static void AddCoefficients(const Term & t1, const Term & t2, Term * result);
+  static Polynomial MultiplicationByTerm(const Polynomial & p, const Term & t);
+  Term * m_terms;
+  int m_numberOfTerms;
+  char m_variables[k_maxNumberOfVariables];
+  int m_numberOfVariables;
+};
+
+struct PolynomialDivision {
+  Polynomial quotient;
+  Polynomial remainder;
+};
+
+}
+
+#endif
@@ -17,6 +17,7 @@ class Power : public StaticHierarchy<2> {
   friend class Division;
   friend class Round;
   friend class Symbol;
+  friend class Polynomial;
 public:
   Type type() const override;
   Expression * clone() const override;
@@ -26,6 +27,10 @@ public:
   template<typename T> static std::complex<T> compute(const std::complex<T> c, const std::complex<T> d);
 private:
   constexpr static int k_maxNumberOfTermsInExpandedMultinome = 25;
+  /* The multinome (a0+a1+...+a(m-1))^n has BinomialCoefficient(n+m-1,n)
+   * terms: it is expanded only if it has at most
+   * k_maxNumberOfTermsInExpandedMultinome terms. */
+  static bool MultinomeCanBeExpanded(int numberOfTermsInBase, const Integer & n);
   constexpr static int k_maxExactPowerMatrix = 100;
   /* Property */
   Expression * setSign(Sign s, Context & context, AngleUnit angleUnit) override;
@@ -38,6 +43,7 @@ private:
   static const char * name() { return "^"; }
   /* Simplify */
   Expression * shallowReduce(Context& context, AngleUnit angleUnit) override;
+  Expression * createDerivative(char symbol, AngleUnit angleUnit) const override;
   Expression * shallowBeautify(Context & context, AngleUnit angleUnit) override;
   int simplificationOrderGreaterType(const Expression * e, bool canBeInterrupted) const override;
   int simplificationOrderSameType(const Expression * e, bool canBeInterrupted) const override;
@@ -56,15 +62,17 @@ private:
   static bool RationalExponentShouldNotBeReduced(const Rational * b, const Rational * r);
   /* Evaluation */
   constexpr static int k_maxApproximatePowerMatrix = 1000;
-  template<typename T> static MatrixComplex<T> computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> n);
-  template<typename T> static MatrixComplex<T> computeOnMatrixAndComplex(const MatrixComplex<T> m, const std::complex<T> d);
-  template<typename T> static MatrixComplex<T> computeOnMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n);
+  template<typename T> static MatrixComplex<T> computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> & n);
+  template<typename T> static MatrixComplex<T> computeOnMatrixAndComplex(const MatrixComplex<T> & m, const std::complex<T> d);
+  template<typename T> static MatrixComplex<T> computeOnMatrices(const MatrixComplex<T> & m, const MatrixComplex<T> & n);
   Evaluation<float> * privateApproximate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override {
     return ApproximationEngine::mapReduce<float>(this, context, angleUnit, compute<float>, computeOnComplexAndMatrix<float>, computeOnMatrixAndComplex<float>, computeOnMatrices<float>);
   }
   Evaluation<double> * privateApproximate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override {
     return ApproximationEngine::mapReduce<double>(this, context, angleUnit, compute<double>, computeOnComplexAndMatrix<double>, computeOnMatrixAndComplex<double>, computeOnMatrices<double>);
   }
+  RealInterval privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const override;
+  DualNumber privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const override;
 };
 
 }
@@ -49,6 +49,7 @@ private:
   Evaluation<double> * privateApproximate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedApproximate<double>(context, angleUnit); }
   template<typename U> Complex<U> * templatedApproximate(Context& context, Expression::AngleUnit angleUnit) const;
   Expression * shallowBeautify(Context & context, AngleUnit angleUnit) override;
+  Expression * createDerivative(char symbol, AngleUnit angleUnit) const override;
   Expression * setSign(Sign s);
   Expression * setSign(Sign s, Context & context, AngleUnit angleUnit) override {
     return setSign(s);
@@ -56,6 +57,7 @@ private:
 
   /* Sorting */
   int simplificationOrderSameType(const Expression * e, bool canBeInterrupted) const override;
+  uint32_t computeHash() const override;
 
   Integer m_numerator;
   Integer m_denominator;
@@ -0,0 +1,65 @@
+#ifndef POINCARE_REAL_INTERVAL_H
+#define POINCARE_REAL_INTERVAL_H
+
+#include <cmath>
+
+namespace Poincare {
+
+/* A RealInterval [lower, upper] encloses the values taken by an expression,
+ * as approximated by approximateWithValueForSymbol, when its symbol ranges
+ * over an interval. Bounds are rounded outward so that the enclosure holds
+ * despite floating-point errors.
+ * Non-real intermediate values can combine into real ones (sqrt(x)^2 with
+ * x < 0): an operation whose operands may leave its real domain is unbounded,
+ * and an unbounded operand may stand for non-real values.
+ * The undefined interval, whose bounds are NAN, is empty: the expression is
+ * undefined on the whole interval. */
+
+class RealInterval {
+public:
+  RealInterval(double lower, double upper) : m_lower(lower), m_upper(upper) {}
+  static RealInterval Undefined() { return RealInterval(NAN, NAN); }
+  static RealInterval Unbounded() { return RealInterval(-INFINITY, INFINITY); }
+  /* Enclosure of a value computed with a relative error of a few ulps, like
+   * the result of a floating-point operation or of a libm function. */
+  static RealInterval Approximate(double value) { return std::isnan(value) ? Undefined() : Outward(value, value); }
+  double lower() const { return m_lower; }
+  double upper() const { return m_upper; }
+  bool isUndefined() const { return std::isnan(m_lower); }
+  bool isPoint() const { return m_lower == m_upper; }
+  bool isUnbounded() const { return m_lower == -INFINITY && m_upper == INFINITY; }
+  bool contains(double value) const { return m_lower <= value && value <= m_upper; }
+  /* Returns true if no value of the interval has an absolute value lower or
+   * equal to threshold. */
+  bool isAwayFromZero(double threshold) const { return isUndefined() || m_lower > threshold || m_upper < -threshold; }
+
+  static RealInterval Union(RealInterval a, RealInterval b);
+  static RealInterval Opposite(RealInterval a);
+  static RealInterval Addition(RealInterval a, RealInterval b);
+  static RealInterval Subtraction(RealInterval a, RealInterval b);
+  static RealInterval Multiplication(RealInterval a, RealInterval b);
+  static RealInterval Division(RealInterval a, RealInterval b);
+  static RealInterval IntegerPower(RealInterval a, int n);
+  static RealInterval Power(RealInterval a, RealInterval b);
+  static RealInterval AbsoluteValue(RealInterval a);
+  static RealInterval SquareRoot(RealInterval a);
+  static RealInterval Exponential(RealInterval a);
+  static RealInterval NaperianLogarithm(RealInterval a);
+  static RealInterval Cosine(RealInterval a);
+  static RealInterval Sine(RealInterval a);
+private:
+  /* The scalar approximation computes powers as exp(y*ln(x)) on complexes,
+   * whose relative error grows with |y*ln(x)|: the bounds are widened far
+   * beyond the error of a single floating-point operation. */
+  constexpr static double k_relativeError = 1E-12;
+  constexpr static double k_maxIntegerPower = 1E9;
+  /* Widen [lower, upper] by the rounding errors. A NAN bound comes from an
+   * indeterminate form (inf-inf, 0*inf...): the result is then unbounded. */
+  static RealInterval Outward(double lower, double upper);
+  double m_lower;
+  double m_upper;
+};
+
+}
+
+#endif
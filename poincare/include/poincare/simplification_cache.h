@@ -0,0 +1,52 @@
+#ifndef POINCARE_SIMPLIFICATION_CACHE_H
+#define POINCARE_SIMPLIFICATION_CACHE_H
+
+#include <poincare/expression.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+class Symbol;
+
+/* A SimplificationCache memoizes Expression::ParseAndSimplify: it maps a text
+ * and an angle unit to the simplified expression. Each entry records the
+ * stored symbols (A-Z, M0-M9) its text refers to, and is discarded as soon as
+ * one of them is modified. When the cache is full, the least recently used
+ * entry is replaced. */
+
+class SimplificationCache {
+public:
+  SimplificationCache();
+  ~SimplificationCache();
+  SimplificationCache(const SimplificationCache& other) = delete;
+  SimplificationCache& operator=(const SimplificationCache& other) = delete;
+  /* Returns a clone of the simplification of text, or nullptr if the text is
+   * not in the cache. The clone has to be deleted by the caller. */
+  Expression * simplifiedExpression(const char * text, Expression::AngleUnit angleUnit);
+  /* Store a clone of simplifiedExpression. expression is the parsed text,
+   * from which the dependencies of the entry are computed. */
+  void store(const char * text, Expression::AngleUnit angleUnit, const Expression * expression, const Expression * simplifiedExpression);
+  static bool CanStore(const char * text, const Expression * expression);
+  void invalidateSymbol(const Symbol * symbol);
+  void reset();
+private:
+  constexpr static int k_numberOfEntries = 16;
+  constexpr static int k_maxTextLength = 64;
+  struct Entry {
+    char text[k_maxTextLength];
+    Expression::AngleUnit angleUnit;
+    Expression * expression; // nullptr if the entry is empty
+    uint64_t dependencies;
+    uint32_t lastUse;
+  };
+  static uint64_t SymbolMask(const Symbol * symbol);
+  static uint64_t Dependencies(const Expression * expression);
+  static bool ContainsStore(const Expression * expression);
+  void resetEntry(Entry * entry);
+  Entry m_entries[k_numberOfEntries];
+  uint32_t m_clock;
+};
+
+}
+
+#endif
@@ -26,6 +26,7 @@ public:
 protected:
   void build(const Expression * const * operands, int numberOfOperands, bool cloneOperands);
   int simplificationOrderSameType(const Expression * e, bool canBeInterrupted) const override;
+  uint32_t computeHash() const override;
   const Expression * m_operands[T];
 };
 
@@ -19,6 +19,12 @@ public:
   constexpr static int k_numberOfEntries = 37;
   static Expression * table(const Expression * e, Expression::Type type, Context & context, Expression::AngleUnit angleUnit); // , Function f, bool inverse
   template <typename T> static std::complex<T> ConvertToRadian(const std::complex<T> c, Expression::AngleUnit angleUnit);
+  static RealInterval ConvertToRadian(RealInterval c, Expression::AngleUnit angleUnit);
+  static DualNumber ConvertToRadian(DualNumber c, Expression::AngleUnit angleUnit);
+  /* Derivative of an angle expressed in radians, and conversion of a
+   * derivative of an angle in radians to the angle unit */
+  static Expression * CreateRadianAngleDerivative(const Expression * angle, char symbol, Expression::AngleUnit angleUnit);
+  static Expression * ConvertRadianDerivativeToAngleUnit(Expression * derivative, Expression::AngleUnit angleUnit);
   template <typename T> static std::complex<T> ConvertRadianToAngleUnit(const std::complex<T> c, Expression::AngleUnit angleUnit);
   template <typename T> static std::complex<T> RoundToMeaningfulDigits(const std::complex<T> c);
 private:
@@ -1,5 +1,8 @@
 #include <poincare/absolute_value.h>
 #include <poincare/simplification_engine.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
+#include <poincare/multiplication.h>
 #include "layout/absolute_value_layout.h"
 
 extern "C" {
@@ -48,6 +51,32 @@ Expression * AbsoluteValue::shallowReduce(Context& context, AngleUnit angleUnit)
   return this;
 }
 
+Expression * AbsoluteValue::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // abs(u)' = u'*u/abs(u)
+  const Expression * multOperands[3] = {operandDerivative, operand(0)->clone(), new Power(this, new Rational(-1), true)};
+  return new Multiplication(multOperands, 3, false);
+}
+
+RealInterval AbsoluteValue::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  return RealInterval::AbsoluteValue(operand(0)->privateApproximateInterval(symbol, x, context, angleUnit));
+}
+
+DualNumber AbsoluteValue::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber a = operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  // abs is only differentiable on non-null real numbers and has a kink on 0
+  std::complex<double> derivative = NAN;
+  if (a.value() == std::complex<double>(0.0)) {
+    derivative = INFINITY;
+  } else if (a.value().imag() == 0.0) {
+    derivative = a.value().real() > 0.0 ? 1.0 : -1.0;
+  }
+  return DualNumber::Composition(a, computeOnComplex<double>(a.value(), angleUnit), derivative);
+}
+
 template<typename T>
 std::complex<T> AbsoluteValue::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   return std::abs(c);
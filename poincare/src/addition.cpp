@@ -180,6 +180,20 @@ Expression * Addition::shallowReduce(Context& context, AngleUnit angleUnit) {
   return result;
 }
 
+Expression * Addition::createDerivative(char symbol, AngleUnit angleUnit) const {
+  // (u+v)' = u'+v'
+  Addition * derivative = new Addition();
+  for (int i = 0; i < numberOfOperands(); i++) {
+    Expression * operandDerivative = operand(i)->createDerivative(symbol, angleUnit);
+    if (operandDerivative == nullptr) {
+      delete derivative;
+      return nullptr;
+    }
+    derivative->addOperand(operandDerivative);
+  }
+  return derivative;
+}
+
 Expression * Addition::factorizeOnCommonDenominator(Context & context, AngleUnit angleUnit) {
   // We want to turn (a/b+c/d+e/b) into (a*d+b*c+e*d)/(b*d)
 
@@ -346,6 +360,22 @@ Expression * Addition::shallowBeautify(Context & context, AngleUnit angleUnit) {
 
 /* Evaluation */
 
+RealInterval Addition::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  RealInterval result = operand(0)->privateApproximateInterval(symbol, x, context, angleUnit);
+  for (int i = 1; i < numberOfOperands(); i++) {
+    result = RealInterval::Addition(result, operand(i)->privateApproximateInterval(symbol, x, context, angleUnit));
+  }
+  return result;
+}
+
+DualNumber Addition::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber result = operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  for (int i = 1; i < numberOfOperands(); i++) {
+    result = DualNumber::Addition(result, operand(i)->privateApproximateWithDerivative(symbol, x, context, angleUnit));
+  }
+  return result;
+}
+
 template<typename T>
 std::complex<T> Addition::compute(const std::complex<T> c, const std::complex<T> d) {
   return c+d;
@@ -354,10 +384,10 @@ std::complex<T> Addition::compute(const std::complex<T> c, const std::complex<T>
 template std::complex<float> Poincare::Addition::compute<float>(std::complex<float>, std::complex<float>);
 template std::complex<double> Poincare::Addition::compute<double>(std::complex<double>, std::complex<double>);
 
-template MatrixComplex<float> Addition::computeOnMatrices<float>(const MatrixComplex<float>,const MatrixComplex<float>);
-template MatrixComplex<double> Addition::computeOnMatrices<double>(const MatrixComplex<double>,const MatrixComplex<double>);
+template MatrixComplex<float> Addition::computeOnMatrices<float>(const MatrixComplex<float> &,const MatrixComplex<float> &);
+template MatrixComplex<double> Addition::computeOnMatrices<double>(const MatrixComplex<double> &,const MatrixComplex<double> &);
 
-template MatrixComplex<float> Addition::computeOnComplexAndMatrix<float>(std::complex<float> const, const MatrixComplex<float>);
-template MatrixComplex<double> Addition::computeOnComplexAndMatrix<double>(std::complex<double> const, const MatrixComplex<double>);
+template MatrixComplex<float> Addition::computeOnComplexAndMatrix<float>(std::complex<float> const, const MatrixComplex<float> &);
+template MatrixComplex<double> Addition::computeOnComplexAndMatrix<double>(std::complex<double> const, const MatrixComplex<double> &);
 
 }
@@ -30,8 +30,10 @@ template<typename T> Evaluation<T> * ApproximationEngine::map(const Expression *
   Evaluation<T> * input = expression->operand(0)->privateApproximate(T(), context, angleUnit);
   Evaluation<T> * result = nullptr;
   if (input->type() == Evaluation<T>::Type::Complex) {
+    // Reuse the input evaluation to store the result
     Complex<T> * c = static_cast<Complex<T> *>(input);
-    result = new Complex<T>(compute(*c, angleUnit));
+    *c = Complex<T>(compute(*c, angleUnit));
+    return c;
   } else {
     assert(input->type() == Evaluation<T>::Type::MatrixComplex);
     MatrixComplex<T> * m = static_cast<MatrixComplex<T> *>(input);
@@ -53,9 +55,17 @@ template<typename T> Evaluation<T> * ApproximationEngine::mapReduce(const Expres
     Evaluation<T> * intermediateResult = nullptr;
     Evaluation<T> * nextOperandEvaluation = expression->operand(i)->privateApproximate(T(), context, angleUnit);
     if (result->type() == Evaluation<T>::Type::Complex && nextOperandEvaluation->type() == Evaluation<T>::Type::Complex) {
-      const Complex<T> * c = static_cast<const Complex<T> *>(result);
+      /* Reduce complexes in place: the next operand evaluation, which is the
+       * last allocated one, is deleted right away. */
+      Complex<T> * c = static_cast<Complex<T> *>(result);
       const Complex<T> * d = static_cast<const Complex<T> *>(nextOperandEvaluation);
-      intermediateResult = new Complex<T>(computeOnComplexes(*c, *d));
+      *c = Complex<T>(computeOnComplexes(*c, *d));
+      delete nextOperandEvaluation;
+      if (c->isUndefined()) {
+        delete result;
+        return new Complex<T>(Complex<T>::Undefined());
+      }
+      continue;
     } else if (result->type() == Evaluation<T>::Type::Complex) {
       const Complex<T> * c = static_cast<const Complex<T> *>(result);
       assert(nextOperandEvaluation->type() == Evaluation<T>::Type::MatrixComplex);
@@ -85,7 +95,7 @@ template<typename T> Evaluation<T> * ApproximationEngine::mapReduce(const Expres
   return result;
 }
 
-template<typename T> MatrixComplex<T> ApproximationEngine::elementWiseOnMatrixComplexAndComplex(const MatrixComplex<T> m, const std::complex<T> c, ComplexAndComplexReduction<T> computeOnComplexes) {
+template<typename T> MatrixComplex<T> ApproximationEngine::elementWiseOnMatrixComplexAndComplex(const MatrixComplex<T> & m, const std::complex<T> c, ComplexAndComplexReduction<T> computeOnComplexes) {
   std::complex<T> * operands = new std::complex<T> [m.numberOfRows()*m.numberOfColumns()];
   for (int i = 0; i < m.numberOfComplexOperands(); i++) {
     const std::complex<T> d = m.complexOperand(i);
@@ -96,7 +106,7 @@ template<typename T> MatrixComplex<T> ApproximationEngine::elementWiseOnMatrixCo
   return result;
 }
 
-template<typename T> MatrixComplex<T> ApproximationEngine::elementWiseOnComplexMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n, ComplexAndComplexReduction<T> computeOnComplexes) {
+template<typename T> MatrixComplex<T> ApproximationEngine::elementWiseOnComplexMatrices(const MatrixComplex<T> & m, const MatrixComplex<T> & n, ComplexAndComplexReduction<T> computeOnComplexes) {
   if (m.numberOfRows() != n.numberOfRows() || m.numberOfColumns() != n.numberOfColumns()) {
     return MatrixComplex<T>::Undefined();
   }
@@ -117,10 +127,10 @@ template Poincare::Evaluation<float> * Poincare::ApproximationEngine::map(const
 template Poincare::Evaluation<double> * Poincare::ApproximationEngine::map(const Poincare::Expression * expression, Poincare::Context& context, Poincare::Expression::AngleUnit angleUnit, Poincare::ApproximationEngine::ComplexCompute<double> compute);
 template Poincare::Evaluation<float> * Poincare::ApproximationEngine::mapReduce(const Poincare::Expression * expression, Poincare::Context& context, Poincare::Expression::AngleUnit angleUnit, Poincare::ApproximationEngine::ComplexAndComplexReduction<float> computeOnComplexes, Poincare::ApproximationEngine::ComplexAndMatrixReduction<float> computeOnComplexAndMatrix, Poincare::ApproximationEngine::MatrixAndComplexReduction<float> computeOnMatrixAndComplex, Poincare::ApproximationEngine::MatrixAndMatrixReduction<float> computeOnMatrices);
 template Poincare::Evaluation<double> * Poincare::ApproximationEngine::mapReduce(const Poincare::Expression * expression, Poincare::Context& context, Poincare::Expression::AngleUnit angleUnit, Poincare::ApproximationEngine::ComplexAndComplexReduction<double> computeOnComplexes, Poincare::ApproximationEngine::ComplexAndMatrixReduction<double> computeOnComplexAndMatrix, Poincare::ApproximationEngine::MatrixAndComplexReduction<double> computeOnMatrixAndComplex, Poincare::ApproximationEngine::MatrixAndMatrixReduction<double> computeOnMatrices);
-template Poincare::MatrixComplex<float> Poincare::ApproximationEngine::elementWiseOnMatrixComplexAndComplex<float>(const Poincare::MatrixComplex<float>, const std::complex<float>, std::complex<float> (*)(std::complex<float>, std::complex<float>));
-template Poincare::MatrixComplex<double> Poincare::ApproximationEngine::elementWiseOnMatrixComplexAndComplex<double>(const Poincare::MatrixComplex<double>, std::complex<double> const, std::complex<double> (*)(std::complex<double>, std::complex<double>));
-template Poincare::MatrixComplex<float> Poincare::ApproximationEngine::elementWiseOnComplexMatrices<float>(const Poincare::MatrixComplex<float>, const Poincare::MatrixComplex<float>, std::complex<float> (*)(std::complex<float>, std::complex<float>));
-template Poincare::MatrixComplex<double> Poincare::ApproximationEngine::elementWiseOnComplexMatrices<double>(const Poincare::MatrixComplex<double>, const Poincare::MatrixComplex<double>, std::complex<double> (*)(std::complex<double>, std::complex<double>));
+template Poincare::MatrixComplex<float> Poincare::ApproximationEngine::elementWiseOnMatrixComplexAndComplex<float>(const Poincare::MatrixComplex<float> &, const std::complex<float>, std::complex<float> (*)(std::complex<float>, std::complex<float>));
+template Poincare::MatrixComplex<double> Poincare::ApproximationEngine::elementWiseOnMatrixComplexAndComplex<double>(const Poincare::MatrixComplex<double> &, std::complex<double> const, std::complex<double> (*)(std::complex<double>, std::complex<double>));
+template Poincare::MatrixComplex<float> Poincare::ApproximationEngine::elementWiseOnComplexMatrices<float>(const Poincare::MatrixComplex<float> &, const Poincare::MatrixComplex<float> &, std::complex<float> (*)(std::complex<float>, std::complex<float>));
+template Poincare::MatrixComplex<double> Poincare::ApproximationEngine::elementWiseOnComplexMatrices<double>(const Poincare::MatrixComplex<double> &, const Poincare::MatrixComplex<double> &, std::complex<double> (*)(std::complex<double>, std::complex<double>));
 
 
 }
@@ -0,0 +1,470 @@
+#include <poincare/approximation_program.h>
+#include <poincare/absolute_value.h>
+#include <poincare/addition.h>
+#include <poincare/arc_cosine.h>
+#include <poincare/arc_sine.h>
+#include <poincare/arc_tangent.h>
+#include <poincare/ceiling.h>
+#include <poincare/complex_argument.h>
+#include <poincare/conjugate.h>
+#include <poincare/cosine.h>
+#include <poincare/division.h>
+#include <poincare/evaluation.h>
+#include <poincare/factorial.h>
+#include <poincare/floor.h>
+#include <poincare/frac_part.h>
+#include <poincare/hyperbolic_arc_cosine.h>
+#include <poincare/hyperbolic_arc_sine.h>
+#include <poincare/hyperbolic_arc_tangent.h>
+#include <poincare/hyperbolic_cosine.h>
+#include <poincare/hyperbolic_sine.h>
+#include <poincare/hyperbolic_tangent.h>
+#include <poincare/imaginary_part.h>
+#include <poincare/logarithm.h>
+#include <poincare/multiplication.h>
+#include <poincare/naperian_logarithm.h>
+#include <poincare/opposite.h>
+#include <poincare/power.h>
+#include <poincare/real_part.h>
+#include <poincare/sine.h>
+#include <poincare/square_root.h>
+#include <poincare/subtraction.h>
+#include <poincare/symbol.h>
+#include <poincare/tangent.h>
+#include <ion.h>
+#include <cmath>
+extern "C" {
+#include <assert.h>
+#include <string.h>
+}
+
+namespace Poincare {
+
+template<typename T>
+ApproximationProgram<T>::ApproximationProgram() :
+  m_expression(nullptr),
+  m_instructions(nullptr),
+  m_constants(nullptr),
+  m_numberOfInstructions(0),
+  m_symbol(0),
+  m_angleUnit(Expression::AngleUnit::Radian)
+{
+}
+
+template<typename T>
+ApproximationProgram<T>::ApproximationProgram(const Expression * expression, char symbol, Context & context, Expression::AngleUnit angleUnit) :
+  ApproximationProgram()
+{
+  compile(expression, symbol, context, angleUnit);
+}
+
+template<typename T>
+ApproximationProgram<T>::~ApproximationProgram() {
+  reset();
+}
+
+template<typename T>
+void ApproximationProgram<T>::compile(const Expression * expression, char symbol, Context & context, Expression::AngleUnit angleUnit) {
+  reset();
+  assert(expression != nullptr);
+  m_expression = expression;
+  m_symbol = symbol;
+  m_angleUnit = angleUnit;
+  Compilation compilation;
+  compilation.numberOfInstructions = 0;
+  compilation.numberOfConstants = 0;
+  compilation.stackDepth = 0;
+  if (!compileExpression(expression, context, &compilation)) {
+    return;
+  }
+  assert(compilation.stackDepth == 1);
+  m_instructions = new Instruction[compilation.numberOfInstructions];
+  memcpy(m_instructions, compilation.instructions, compilation.numberOfInstructions*sizeof(Instruction));
+  if (compilation.numberOfConstants > 0) {
+    m_constants = new std::complex<T>[compilation.numberOfConstants];
+    for (int i = 0; i < compilation.numberOfConstants; i++) {
+      m_constants[i] = compilation.constants[i];
+    }
+  }
+  m_numberOfInstructions = compilation.numberOfInstructions;
+}
+
+template<typename T>
+void ApproximationProgram<T>::reset() {
+  if (m_instructions != nullptr) {
+    delete[] m_instructions;
+    m_instructions = nullptr;
+  }
+  if (m_constants != nullptr) {
+    delete[] m_constants;
+    m_constants = nullptr;
+  }
+  m_numberOfInstructions = 0;
+  m_expression = nullptr;
+}
+
+template<typename T>
+T ApproximationProgram<T>::approximateWithValueForSymbol(T x, Context & context) const {
+  assert(m_expression != nullptr);
+  if (!isCompiled()) {
+    return m_expression->approximateWithValueForSymbol(m_symbol, x, context, m_angleUnit);
+  }
+  /* Results are wrapped in Complex as in the tree approximation, which
+   * normalizes signed zeros. */
+  std::complex<T> stack[k_maxStackDepth];
+  int stackSize = 0;
+  for (int i = 0; i < m_numberOfInstructions; i++) {
+    const Instruction & instruction = m_instructions[i];
+    switch (instruction.opcode) {
+      case Opcode::PushConstant:
+        stack[stackSize++] = m_constants[instruction.constantIndex];
+        break;
+      case Opcode::PushSymbol:
+        stack[stackSize++] = std::complex<T>(x);
+        break;
+      case Opcode::PushVariable:
+      {
+        Evaluation<T> * evaluation = instruction.variable->privateApproximate(T(), context, m_angleUnit);
+        stack[stackSize++] = evaluation->type() == Evaluation<T>::Type::Complex ? *static_cast<Complex<T> *>(evaluation) : Complex<T>::Undefined();
+        delete evaluation;
+        break;
+      }
+      case Opcode::Opposite:
+      case Opcode::Unary:
+        stack[stackSize-1] = Complex<T>(instruction.unary(stack[stackSize-1], m_angleUnit));
+        break;
+      case Opcode::Addition:
+      case Opcode::Subtraction:
+      case Opcode::Multiplication:
+      case Opcode::Binary:
+        stackSize--;
+        stack[stackSize-1] = Complex<T>(instruction.binary(stack[stackSize-1], stack[stackSize]));
+        break;
+    }
+  }
+  assert(stackSize == 1);
+  return Complex<T>(stack[0]).toScalar();
+}
+
+template<typename T>
+void ApproximationProgram<T>::approximateWithValuesForSymbol(const T * x, T * y, int n, Context & context) const {
+  assert(m_expression != nullptr);
+  if (!isCompiled()) {
+    for (int i = 0; i < n; i++) {
+      y[i] = m_expression->approximateWithValueForSymbol(m_symbol, x[i], context, m_angleUnit);
+    }
+    return;
+  }
+  for (int i = 0; i < n; i += k_batchSize) {
+    approximateBatch(x+i, y+i, n-i < k_batchSize ? n-i : k_batchSize, context);
+  }
+}
+
+template<typename T>
+void ApproximationProgram<T>::approximateBatch(const T * x, T * y, int n, Context & context) const {
+  assert(n <= k_batchSize);
+  /* The stack stores real and imaginary parts in separate lanes, so that
+   * component-wise operations are plain loops on arrays of floating-point
+   * numbers. Other kernels are called on each value of the batch. */
+  T real[k_maxStackDepth][k_batchSize];
+  T imag[k_maxStackDepth][k_batchSize];
+  int stackSize = 0;
+  for (int i = 0; i < m_numberOfInstructions; i++) {
+    const Instruction & instruction = m_instructions[i];
+    switch (instruction.opcode) {
+      case Opcode::PushConstant:
+      case Opcode::PushVariable:
+      {
+        std::complex<T> c;
+        if (instruction.opcode == Opcode::PushConstant) {
+          c = m_constants[instruction.constantIndex];
+        } else {
+          Evaluation<T> * evaluation = instruction.variable->privateApproximate(T(), context, m_angleUnit);
+          c = evaluation->type() == Evaluation<T>::Type::Complex ? *static_cast<Complex<T> *>(evaluation) : Complex<T>::Undefined();
+          delete evaluation;
+        }
+        for (int j = 0; j < n; j++) {
+          real[stackSize][j] = c.real();
+          imag[stackSize][j] = c.imag();
+        }
+        stackSize++;
+        break;
+      }
+      case Opcode::PushSymbol:
+        for (int j = 0; j < n; j++) {
+          real[stackSize][j] = x[j];
+          imag[stackSize][j] = 0;
+        }
+        stackSize++;
+        break;
+      case Opcode::Opposite:
+        for (int j = 0; j < n; j++) {
+          real[stackSize-1][j] = -real[stackSize-1][j];
+          imag[stackSize-1][j] = -imag[stackSize-1][j];
+        }
+        NormalizeZeros(real[stackSize-1], n);
+        NormalizeZeros(imag[stackSize-1], n);
+        break;
+      case Opcode::Addition:
+        stackSize--;
+        for (int j = 0; j < n; j++) {
+          real[stackSize-1][j] += real[stackSize][j];
+          imag[stackSize-1][j] += imag[stackSize][j];
+        }
+        NormalizeZeros(real[stackSize-1], n);
+        NormalizeZeros(imag[stackSize-1], n);
+        break;
+      case Opcode::Subtraction:
+        stackSize--;
+        for (int j = 0; j < n; j++) {
+          real[stackSize-1][j] -= real[stackSize][j];
+          imag[stackSize-1][j] -= imag[stackSize][j];
+        }
+        NormalizeZeros(real[stackSize-1], n);
+        NormalizeZeros(imag[stackSize-1], n);
+        break;
+      case Opcode::Multiplication:
+      {
+        stackSize--;
+        /* The complex product of finite reals is their real product: infinite
+         * and complex values go through the complex kernel. */
+        bool finiteReals = true;
+        for (int j = 0; j < n; j++) {
+          finiteReals = finiteReals && imag[stackSize-1][j] == 0 && imag[stackSize][j] == 0 && std::isfinite(real[stackSize-1][j]) && std::isfinite(real[stackSize][j]);
+        }
+        if (finiteReals) {
+          for (int j = 0; j < n; j++) {
+            real[stackSize-1][j] *= real[stackSize][j];
+          }
+          NormalizeZeros(real[stackSize-1], n);
+        } else {
+          ApproximateBinaryOnBatch(instruction.binary, real[stackSize-1], imag[stackSize-1], real[stackSize], imag[stackSize], n);
+        }
+        break;
+      }
+      case Opcode::Binary:
+        stackSize--;
+        ApproximateBinaryOnBatch(instruction.binary, real[stackSize-1], imag[stackSize-1], real[stackSize], imag[stackSize], n);
+        break;
+      case Opcode::Unary:
+        for (int j = 0; j < n; j++) {
+          Complex<T> c(instruction.unary(std::complex<T>(real[stackSize-1][j], imag[stackSize-1][j]), m_angleUnit));
+          real[stackSize-1][j] = c.real();
+          imag[stackSize-1][j] = c.imag();
+        }
+        break;
+    }
+  }
+  assert(stackSize == 1);
+  for (int j = 0; j < n; j++) {
+    y[j] = imag[0][j] == 0 ? real[0][j] : NAN;
+  }
+}
+
+template<typename T>
+bool ApproximationProgram<T>::compileExpression(const Expression * e, Context & context, Compilation * compilation) const {
+  Instruction instruction;
+  if (isConstant(e)) {
+    Evaluation<T> * evaluation = e->privateApproximate(T(), context, m_angleUnit);
+    if (evaluation->type() != Evaluation<T>::Type::Complex || compilation->numberOfConstants >= k_maxNumberOfConstants) {
+      delete evaluation;
+      return false;
+    }
+    compilation->constants[compilation->numberOfConstants] = *static_cast<Complex<T> *>(evaluation);
+    delete evaluation;
+    instruction.opcode = Opcode::PushConstant;
+    instruction.constantIndex = compilation->numberOfConstants++;
+    return emit(compilation, instruction, 1);
+  }
+  Expression::Type type = e->type();
+  if (type == Expression::Type::Symbol) {
+    const Symbol * symbol = static_cast<const Symbol *>(e);
+    if (symbol->name() == m_symbol) {
+      instruction.opcode = Opcode::PushSymbol;
+    } else if (symbol->isMatrixSymbol()) {
+      return false;
+    } else {
+      instruction.opcode = Opcode::PushVariable;
+      instruction.variable = symbol;
+    }
+    return emit(compilation, instruction, 1);
+  }
+  if (type == Expression::Type::Parenthesis) {
+    return compileExpression(e->operand(0), context, compilation);
+  }
+  if (type == Expression::Type::Logarithm && e->numberOfOperands() == 2) {
+    // log(x, n) = log(x)/log(n)
+    instruction.opcode = Opcode::Unary;
+    instruction.unary = Logarithm::computeOnComplex<T>;
+    if (!compileExpression(e->operand(0), context, compilation) || !emit(compilation, instruction, 0) || !compileExpression(e->operand(1), context, compilation) || !emit(compilation, instruction, 0)) {
+      return false;
+    }
+    instruction.opcode = Opcode::Binary;
+    instruction.binary = Division::compute<T>;
+    return emit(compilation, instruction, -1);
+  }
+  ApproximationEngine::ComplexCompute<T> unary = UnaryKernel(type);
+  if (unary != nullptr) {
+    assert(e->numberOfOperands() == 1);
+    instruction.opcode = type == Expression::Type::Opposite ? Opcode::Opposite : Opcode::Unary;
+    instruction.unary = unary;
+    return compileExpression(e->operand(0), context, compilation) && emit(compilation, instruction, 0);
+  }
+  ApproximationEngine::ComplexAndComplexReduction<T> binary = BinaryKernel(type);
+  if (binary == nullptr || !compileExpression(e->operand(0), context, compilation)) {
+    return false;
+  }
+  // Operands are reduced from left to right, as in ApproximationEngine::mapReduce
+  instruction.opcode = BinaryOpcode(type);
+  instruction.binary = binary;
+  for (int i = 1; i < e->numberOfOperands(); i++) {
+    if (!compileExpression(e->operand(i), context, compilation) || !emit(compilation, instruction, -1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+bool ApproximationProgram<T>::isConstant(const Expression * e) const {
+  /* Random numbers have to be drawn at each approximation: they are handled as
+   * variables, which prevents the compilation. */
+  if (e->type() == Expression::Type::Random || e->type() == Expression::Type::Randint) {
+    return false;
+  }
+  if (e->type() == Expression::Type::Symbol) {
+    char name = static_cast<const Symbol *>(e)->name();
+    return name == Ion::Charset::SmallPi || name == Ion::Charset::Exponential || name == Ion::Charset::IComplex;
+  }
+  for (int i = 0; i < e->numberOfOperands(); i++) {
+    if (!isConstant(e->operand(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+bool ApproximationProgram<T>::emit(Compilation * compilation, Instruction instruction, int stackVariation) {
+  if (compilation->numberOfInstructions >= k_maxNumberOfInstructions) {
+    return false;
+  }
+  compilation->stackDepth += stackVariation;
+  if (compilation->stackDepth > k_maxStackDepth) {
+    return false;
+  }
+  compilation->instructions[compilation->numberOfInstructions++] = instruction;
+  return true;
+}
+
+template<typename T>
+ApproximationEngine::ComplexCompute<T> ApproximationProgram<T>::UnaryKernel(Expression::Type type) {
+  switch (type) {
+    case Expression::Type::AbsoluteValue:
+      return AbsoluteValue::computeOnComplex<T>;
+    case Expression::Type::ArcCosine:
+      return ArcCosine::computeOnComplex<T>;
+    case Expression::Type::ArcSine:
+      return ArcSine::computeOnComplex<T>;
+    case Expression::Type::ArcTangent:
+      return ArcTangent::computeOnComplex<T>;
+    case Expression::Type::Ceiling:
+      return Ceiling::computeOnComplex<T>;
+    case Expression::Type::ComplexArgument:
+      return ComplexArgument::computeOnComplex<T>;
+    case Expression::Type::Conjugate:
+      return Conjugate::computeOnComplex<T>;
+    case Expression::Type::Cosine:
+      return Cosine::computeOnComplex<T>;
+    case Expression::Type::Factorial:
+      return Factorial::computeOnComplex<T>;
+    case Expression::Type::Floor:
+      return Floor::computeOnComplex<T>;
+    case Expression::Type::FracPart:
+      return FracPart::computeOnComplex<T>;
+    case Expression::Type::HyperbolicArcCosine:
+      return HyperbolicArcCosine::computeOnComplex<T>;
+    case Expression::Type::HyperbolicArcSine:
+      return HyperbolicArcSine::computeOnComplex<T>;
+    case Expression::Type::HyperbolicArcTangent:
+      return HyperbolicArcTangent::computeOnComplex<T>;
+    case Expression::Type::HyperbolicCosine:
+      return HyperbolicCosine::computeOnComplex<T>;
+    case Expression::Type::HyperbolicSine:
+      return HyperbolicSine::computeOnComplex<T>;
+    case Expression::Type::HyperbolicTangent:
+      return HyperbolicTangent::computeOnComplex<T>;
+    case Expression::Type::ImaginaryPart:
+      return ImaginaryPart::computeOnComplex<T>;
+    case Expression::Type::Logarithm:
+      return Logarithm::computeOnComplex<T>;
+    case Expression::Type::NaperianLogarithm:
+      return NaperianLogarithm::computeOnComplex<T>;
+    case Expression::Type::Opposite:
+      return Opposite::compute<T>;
+    case Expression::Type::RealPart:
+      return RealPart::computeOnComplex<T>;
+    case Expression::Type::Sine:
+      return Sine::computeOnComplex<T>;
+    case Expression::Type::SquareRoot:
+      return SquareRoot::computeOnComplex<T>;
+    case Expression::Type::Tangent:
+      return Tangent::computeOnComplex<T>;
+    default:
+      return nullptr;
+  }
+}
+
+template<typename T>
+ApproximationEngine::ComplexAndComplexReduction<T> ApproximationProgram<T>::BinaryKernel(Expression::Type type) {
+  switch (type) {
+    case Expression::Type::Addition:
+      return Addition::compute<T>;
+    case Expression::Type::Division:
+      return Division::compute<T>;
+    case Expression::Type::Multiplication:
+      return Multiplication::compute<T>;
+    case Expression::Type::Power:
+      return Power::compute<T>;
+    case Expression::Type::Subtraction:
+      return Subtraction::compute<T>;
+    default:
+      return nullptr;
+  }
+}
+
+template<typename T>
+typename ApproximationProgram<T>::Opcode ApproximationProgram<T>::BinaryOpcode(Expression::Type type) {
+  switch (type) {
+    case Expression::Type::Addition:
+      return Opcode::Addition;
+    case Expression::Type::Multiplication:
+      return Opcode::Multiplication;
+    case Expression::Type::Subtraction:
+      return Opcode::Subtraction;
+    default:
+      return Opcode::Binary;
+  }
+}
+
+template<typename T>
+void ApproximationProgram<T>::ApproximateBinaryOnBatch(ApproximationEngine::ComplexAndComplexReduction<T> kernel, T * real, T * imag, const T * otherReal, const T * otherImag, int n) {
+  for (int j = 0; j < n; j++) {
+    Complex<T> c(kernel(std::complex<T>(real[j], imag[j]), std::complex<T>(otherReal[j], otherImag[j])));
+    real[j] = c.real();
+    imag[j] = c.imag();
+  }
+}
+
+template<typename T>
+void ApproximationProgram<T>::NormalizeZeros(T * lane, int n) {
+  // Replace -0 by 0, as the constructor of Complex does
+  for (int j = 0; j < n; j++) {
+    lane[j] = lane[j] == 0 ? 0 : lane[j];
+  }
+}
+
+template class ApproximationProgram<float>;
+template class ApproximationProgram<double>;
+
+}
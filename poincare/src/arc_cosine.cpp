@@ -1,6 +1,10 @@
 #include <poincare/arc_cosine.h>
 #include <poincare/trigonometry.h>
 #include <poincare/simplification_engine.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
+#include <poincare/multiplication.h>
+#include <poincare/subtraction.h>
 extern "C" {
 #include <assert.h>
 }
@@ -30,6 +34,17 @@ Expression * ArcCosine::shallowReduce(Context& context, AngleUnit angleUnit) {
   return Trigonometry::shallowReduceInverseFunction(this, context, angleUnit);
 }
 
+Expression * ArcCosine::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // acos(u)' = -u'/sqrt(1-u^2)
+  Subtraction * s = new Subtraction(new Rational(1), new Power(operand(0), new Rational(2), true), false);
+  const Expression * multOperands[3] = {new Rational(-1), new Power(s, new Rational(-1, 2), false), operandDerivative};
+  return Trigonometry::ConvertRadianDerivativeToAngleUnit(new Multiplication(multOperands, 3, false), angleUnit);
+}
+
 template<typename T>
 std::complex<T> ArcCosine::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> result = std::acos(c);
@@ -1,6 +1,10 @@
 #include <poincare/arc_tangent.h>
 #include <poincare/trigonometry.h>
 #include <poincare/simplification_engine.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
+#include <poincare/multiplication.h>
+#include <poincare/addition.h>
 extern "C" {
 #include <assert.h>
 }
@@ -30,6 +34,17 @@ Expression * ArcTangent::shallowReduce(Context& context, AngleUnit angleUnit) {
   return Trigonometry::shallowReduceInverseFunction(this, context, angleUnit);
 }
 
+Expression * ArcTangent::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // atan(u)' = u'/(1+u^2)
+  Addition * a = new Addition(new Rational(1), new Power(operand(0), new Rational(2), true), false);
+  Multiplication * derivative = new Multiplication(new Power(a, new Rational(-1), false), operandDerivative, false);
+  return Trigonometry::ConvertRadianDerivativeToAngleUnit(derivative, angleUnit);
+}
+
 template<typename T>
 std::complex<T> ArcTangent::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> result = std::atan(c);
@@ -1,5 +1,8 @@
 #include <poincare/arithmetic.h>
+#include <poincare/expression.h>
 #include <utility>
+#include <string.h>
+#include <assert.h>
 
 namespace Poincare {
 
@@ -7,91 +10,420 @@ Integer Arithmetic::LCM(const Integer * a, const Integer * b) {
   if (a->isZero() || b->isZero()) {
     return Integer(0);
   }
-  Integer signResult = Integer::Division(Integer::Multiplication(*a, *b), GCD(a,b)).quotient;
+  // Divide before multiplying to work on smaller integers
+  Integer signResult = Integer::Multiplication(Integer::Division(*a, GCD(a,b)).quotient, *b);
   signResult.setNegative(false);
   return signResult;
 }
 
 Integer Arithmetic::GCD(const Integer * a, const Integer * b) {
-  Integer i = *a;
-  Integer j = *b;
-  i.setNegative(false);
-  j.setNegative(false);
-  do {
-    if (i.isZero()) {
-      return j;
+  return Integer::ugcd(*a, *b);
+}
+
+int primeFactors[Arithmetic::k_numberOfPrimeFactors] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619, 1621, 1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753, 1759, 1777, 1783, 1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879, 1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993, 1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039, 2053, 2063, 2069, 2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129, 2131, 2137, 2141, 2143, 2153, 2161, 2179, 2203, 2207, 2213, 2221, 2237, 2239, 2243, 2251, 2267, 2269, 2273, 2281, 2287, 2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347, 2351, 2357, 2371, 2377, 2381, 2383, 2389, 2393, 2399, 2411, 2417, 2423, 2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521, 2531, 2539, 2543, 2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617, 2621, 2633, 2647, 2657, 2659, 2663, 2671, 2677, 2683, 2687, 2689, 2693, 2699, 2707, 2711, 2713, 2719, 2729, 2731, 2741, 2749, 2753, 2767, 2777, 2789, 2791, 2797, 2801, 2803, 2819, 2833, 2837, 2843, 2851, 2857, 2861, 2879, 2887, 2897, 2903, 2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999, 3001, 3011, 3019, 3023, 3037, 3041, 3049, 3061, 3067, 3079, 3083, 3089, 3109, 3119, 3121, 3137, 3163, 3167, 3169, 3181, 3187, 3191, 3203, 3209, 3217, 3221, 3229, 3251, 3253, 3257, 3259, 3271, 3299, 3301, 3307, 3313, 3319, 3323, 3329, 3331, 3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413, 3433, 3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511, 3517, 3527, 3529, 3533, 3539, 3541, 3547, 3557, 3559, 3571, 3581, 3583, 3593, 3607, 3613, 3617, 3623, 3631, 3637, 3643,
+  3659, 3671, 3673, 3677, 3691, 3697, 3701, 3709, 3719, 3727, 3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797, 3803, 3821, 3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907, 3911, 3917, 3919, 3923, 3929, 3931, 3943, 3947, 3967, 3989, 4001, 4003, 4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057, 4073, 4079, 4091, 4093, 4099, 4111, 4127, 4129, 4133, 4139, 4153, 4157, 4159, 4177, 4201, 4211, 4217, 4219, 4229, 4231, 4241, 4243, 4253, 4259, 4261, 4271, 4273, 4283, 4289, 4297, 4327, 4337, 4339, 4349, 4357, 4363, 4373, 4391, 4397, 4409, 4421, 4423, 4441, 4447, 4451, 4457, 4463, 4481, 4483, 4493, 4507, 4513, 4517, 4519, 4523, 4547, 4549, 4561, 4567, 4583, 4591, 4597, 4603, 4621, 4637, 4639, 4643, 4649, 4651, 4657, 4663, 4673, 4679, 4691, 4703, 4721, 4723, 4729, 4733, 4751, 4759, 4783, 4787, 4789, 4793, 4799, 4801, 4813, 4817, 4831, 4861, 4871, 4877, 4889, 4903, 4909, 4919, 4931, 4933, 4937, 4943, 4951, 4957, 4967, 4969, 4973, 4987, 4993, 4999, 5003, 5009, 5011, 5021, 5023, 5039, 5051, 5059, 5077, 5081, 5087, 5099, 5101, 5107, 5113, 5119, 5147, 5153, 5167, 5171, 5179, 5189, 5197, 5209, 5227, 5231, 5233, 5237, 5261, 5273, 5279, 5281, 5297, 5303, 5309, 5323, 5333, 5347, 5351, 5381, 5387, 5393, 5399, 5407, 5413, 5417, 5419, 5431, 5437, 5441, 5443, 5449, 5471, 5477, 5479, 5483, 5501, 5503, 5507, 5519, 5521, 5527, 5531, 5557, 5563, 5569, 5573, 5581, 5591, 5623, 5639, 5641, 5647, 5651, 5653, 5657, 5659, 5669, 5683, 5689, 5693, 5701, 5711, 5717, 5737, 5741, 5743, 5749, 5779, 5783, 5791, 5801, 5807, 5813, 5821, 5827, 5839, 5843, 5849, 5851, 5857, 5861, 5867, 5869, 5879, 5881, 5897, 5903, 5923, 5927, 5939, 5953, 5981, 5987, 6007, 6011, 6029, 6037, 6043, 6047, 6053, 6067, 6073, 6079, 6089, 6091, 6101, 6113, 6121, 6131, 6133, 6143, 6151, 6163, 6173, 6197, 6199, 6203, 6211, 6217, 6221, 6229, 6247, 6257, 6263, 6269, 6271, 6277, 6287, 6299, 6301, 6311, 6317, 6323, 6329, 6337, 6343, 6353, 6359, 6361, 6367, 6373, 6379, 6389, 6397, 6421, 6427, 6449, 6451, 6469, 6473, 6481, 6491, 6521, 6529, 6547, 6551, 6553, 6563, 6569, 6571, 6577, 6581, 6599, 6607, 6619, 6637, 6653, 6659, 6661, 6673, 6679, 6689, 6691, 6701, 6703, 6709, 6719, 6733, 6737, 6761, 6763, 6779, 6781, 6791, 6793, 6803, 6823, 6827, 6829, 6833, 6841, 6857, 6863, 6869, 6871, 6883, 6899, 6907, 6911, 6917, 6947, 6949, 6959, 6961, 6967, 6971, 6977, 6983, 6991, 6997, 7001, 7013, 7019, 7027, 7039, 7043, 7057, 7069, 7079, 7103, 7109, 7121, 7127, 7129, 7151, 7159, 7177, 7187, 7193, 7207, 7211, 7213, 7219, 7229, 7237, 7243, 7247, 7253, 7283, 7297, 7307, 7309, 7321, 7331, 7333, 7349, 7351, 7369, 7393, 7411, 7417, 7433, 7451, 7457, 7459, 7477, 7481, 7487, 7489, 7499, 7507, 7517, 7523, 7529, 7537, 7541, 7547, 7549, 7559, 7561, 7573, 7577, 7583, 7589, 7591, 7603, 7607, 7621, 7639, 7643, 7649, 7669, 7673, 7681, 7687, 7691, 7699, 7703, 7717, 7723, 7727, 7741, 7753, 7757, 7759, 7789, 7793, 7817, 7823, 7829, 7841, 7853, 7867, 7873, 7877, 7879, 7883, 7901, 7907, 7919};
+
+typedef Integer::native_uint_t native_uint_t;
+typedef Integer::double_native_uint_t double_native_uint_t;
+
+/* Modular arithmetic with an odd modulus N of n digits in Montgomery
+ * representation: x is represented by xR mod N with R = 2^(32n). Products are
+ * then reduced without any division. */
+class Montgomery {
+public:
+  constexpr static int k_maxNumberOfDigits = Arithmetic::k_maxNumberOfDigitsToFactorize;
+  Montgomery(const native_uint_t * modulus, int numberOfDigits);
+  int numberOfDigits() const { return m_numberOfDigits; }
+  const native_uint_t * one() const { return m_R; }
+  void toMontgomery(const native_uint_t * a, native_uint_t * result) const { multiply(a, m_RSquare, result); }
+  void multiply(const native_uint_t * a, const native_uint_t * b, native_uint_t * result) const;
+  void add(const native_uint_t * a, const native_uint_t * b, native_uint_t * result) const;
+  void subtract(const native_uint_t * a, const native_uint_t * b, native_uint_t * result) const;
+  void power(const native_uint_t * a, const native_uint_t * exponent, int exponentNumberOfDigits, native_uint_t * result) const;
+  bool areEqual(const native_uint_t * a, const native_uint_t * b) const { return compare(a, b) == 0; }
+private:
+  int compare(const native_uint_t * a, const native_uint_t * b) const;
+  // a -= N, return the borrow
+  native_uint_t subtractModulus(native_uint_t * a) const;
+  void doubleInPlace(native_uint_t * a) const;
+  native_uint_t m_modulus[k_maxNumberOfDigits];
+  native_uint_t m_R[k_maxNumberOfDigits];
+  native_uint_t m_RSquare[k_maxNumberOfDigits];
+  native_uint_t m_inverse; // -1/N mod 2^32
+  int m_numberOfDigits;
+};
+
+Montgomery::Montgomery(const native_uint_t * modulus, int numberOfDigits) :
+  m_numberOfDigits(numberOfDigits)
+{
+  assert(numberOfDigits <= k_maxNumberOfDigits);
+  assert(modulus[0] & 1);
+  memcpy(m_modulus, modulus, numberOfDigits*sizeof(native_uint_t));
+  // Newton iteration doubles the number of correct bits of 1/N mod 2^32
+  native_uint_t inverse = m_modulus[0];
+  for (int i = 0; i < 4; i++) {
+    inverse *= 2 - m_modulus[0]*inverse;
+  }
+  m_inverse = -inverse;
+  // R and R^2 mod N are computed by doubling 1
+  memset(m_R, 0, numberOfDigits*sizeof(native_uint_t));
+  m_R[0] = 1;
+  for (int i = 0; i < 32*numberOfDigits; i++) {
+    doubleInPlace(m_R);
+  }
+  memcpy(m_RSquare, m_R, numberOfDigits*sizeof(native_uint_t));
+  for (int i = 0; i < 32*numberOfDigits; i++) {
+    doubleInPlace(m_RSquare);
+  }
+}
+
+void Montgomery::multiply(const native_uint_t * a, const native_uint_t * b, native_uint_t * result) const {
+  // Coarsely Integrated Operand Scanning
+  native_uint_t t[k_maxNumberOfDigits+2];
+  memset(t, 0, (m_numberOfDigits+2)*sizeof(native_uint_t));
+  for (int i = 0; i < m_numberOfDigits; i++) {
+    double_native_uint_t carry = 0;
+    for (int j = 0; j < m_numberOfDigits; j++) {
+      carry += (double_native_uint_t)a[j]*b[i] + t[j];
+      t[j] = (native_uint_t)carry;
+      carry >>= 32;
+    }
+    carry += t[m_numberOfDigits];
+    t[m_numberOfDigits] = (native_uint_t)carry;
+    t[m_numberOfDigits+1] = carry >> 32;
+    // Add q*N so that t is divisible by 2^32, and shift t
+    native_uint_t q = t[0]*m_inverse;
+    carry = ((double_native_uint_t)q*m_modulus[0] + t[0]) >> 32;
+    for (int j = 1; j < m_numberOfDigits; j++) {
+      carry += (double_native_uint_t)q*m_modulus[j] + t[j];
+      t[j-1] = (native_uint_t)carry;
+      carry >>= 32;
+    }
+    carry += t[m_numberOfDigits];
+    t[m_numberOfDigits-1] = (native_uint_t)carry;
+    t[m_numberOfDigits] = t[m_numberOfDigits+1] + (carry >> 32);
+  }
+  // t < 2N
+  if (t[m_numberOfDigits] != 0 || compare(t, m_modulus) >= 0) {
+    subtractModulus(t);
+  }
+  memcpy(result, t, m_numberOfDigits*sizeof(native_uint_t));
+}
+
+void Montgomery::add(const native_uint_t * a, const native_uint_t * b, native_uint_t * result) const {
+  native_uint_t carry = 0;
+  for (int i = 0; i < m_numberOfDigits; i++) {
+    native_uint_t sum = a[i] + carry;
+    carry = sum < carry;
+    result[i] = sum + b[i];
+    carry += result[i] < sum;
+  }
+  if (carry != 0 || compare(result, m_modulus) >= 0) {
+    subtractModulus(result);
+  }
+}
+
+void Montgomery::subtract(const native_uint_t * a, const native_uint_t * b, native_uint_t * result) const {
+  native_uint_t borrow = 0;
+  for (int i = 0; i < m_numberOfDigits; i++) {
+    native_uint_t difference = a[i] - b[i];
+    native_uint_t newBorrow = a[i] < b[i];
+    newBorrow += difference < borrow;
+    result[i] = difference - borrow;
+    borrow = newBorrow;
+  }
+  if (borrow != 0) {
+    // Add N back, the carry cancels the borrow
+    native_uint_t carry = 0;
+    for (int i = 0; i < m_numberOfDigits; i++) {
+      native_uint_t sum = result[i] + carry;
+      carry = sum < carry;
+      result[i] = sum + m_modulus[i];
+      carry += result[i] < sum;
     }
-    if (j.isZero()) {
-      return i;
+  }
+}
+
+void Montgomery::power(const native_uint_t * a, const native_uint_t * exponent, int exponentNumberOfDigits, native_uint_t * result) const {
+  native_uint_t p[k_maxNumberOfDigits];
+  memcpy(p, m_R, m_numberOfDigits*sizeof(native_uint_t));
+  for (int i = exponentNumberOfDigits-1; i >= 0; i--) {
+    native_uint_t digit = exponent[i];
+    for (int j = 31; j >= 0; j--) {
+      multiply(p, p, p);
+      if ((digit >> j) & 1) {
+        multiply(p, a, p);
+      }
     }
-    if (j.isLowerThan(i)) {
-      i = Integer::Division(i, j).remainder;
-    } else {
-      j = Integer::Division(j, i).remainder;
+  }
+  memcpy(result, p, m_numberOfDigits*sizeof(native_uint_t));
+}
+
+int Montgomery::compare(const native_uint_t * a, const native_uint_t * b) const {
+  for (int i = m_numberOfDigits-1; i >= 0; i--) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i] ? -1 : 1;
     }
-  } while(true);
+  }
+  return 0;
 }
 
-int primeFactors[Arithmetic::k_numberOfPrimeFactors] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619, 1621, 1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753, 1759, 1777, 1783, 1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879, 1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993, 1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039, 2053, 2063, 2069, 2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129, 2131, 2137, 2141, 2143, 2153, 2161, 2179, 2203, 2207, 2213, 2221, 2237, 2239, 2243, 2251, 2267, 2269, 2273, 2281, 2287, 2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347, 2351, 2357, 2371, 2377, 2381, 2383, 2389, 2393, 2399, 2411, 2417, 2423, 2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521, 2531, 2539, 2543, 2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617, 2621, 2633, 2647, 2657, 2659, 2663, 2671, 2677, 2683, 2687, 2689, 2693, 2699, 2707, 2711, 2713, 2719, 2729, 2731, 2741, 2749, 2753, 2767, 2777, 2789, 2791, 2797, 2801, 2803, 2819, 2833, 2837, 2843, 2851, 2857, 2861, 2879, 2887, 2897, 2903, 2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999, 3001, 3011, 3019, 3023, 3037, 3041, 3049, 3061, 3067, 3079, 3083, 3089, 3109, 3119, 3121, 3137, 3163, 3167, 3169, 3181, 3187, 3191, 3203, 3209, 3217, 3221, 3229, 3251, 3253, 3257, 3259, 3271, 3299, 3301, 3307, 3313, 3319, 3323, 3329, 3331, 3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413, 3433, 3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511, 3517, 3527, 3529, 3533, 3539, 3541, 3547, 3557, 3559, 3571, 3581, 3583, 3593, 3607, 3613, 3617, 3623, 3631, 3637, 3643,
-  3659, 3671, 3673, 3677, 3691, 3697, 3701, 3709, 3719, 3727, 3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797, 3803, 3821, 3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907, 3911, 3917, 3919, 3923, 3929, 3931, 3943, 3947, 3967, 3989, 4001, 4003, 4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057, 4073, 4079, 4091, 4093, 4099, 4111, 4127, 4129, 4133, 4139, 4153, 4157, 4159, 4177, 4201, 4211, 4217, 4219, 4229, 4231, 4241, 4243, 4253, 4259, 4261, 4271, 4273, 4283, 4289, 4297, 4327, 4337, 4339, 4349, 4357, 4363, 4373, 4391, 4397, 4409, 4421, 4423, 4441, 4447, 4451, 4457, 4463, 4481, 4483, 4493, 4507, 4513, 4517, 4519, 4523, 4547, 4549, 4561, 4567, 4583, 4591, 4597, 4603, 4621, 4637, 4639, 4643, 4649, 4651, 4657, 4663, 4673, 4679, 4691, 4703, 4721, 4723, 4729, 4733, 4751, 4759, 4783, 4787, 4789, 4793, 4799, 4801, 4813, 4817, 4831, 4861, 4871, 4877, 4889, 4903, 4909, 4919, 4931, 4933, 4937, 4943, 4951, 4957, 4967, 4969, 4973, 4987, 4993, 4999, 5003, 5009, 5011, 5021, 5023, 5039, 5051, 5059, 5077, 5081, 5087, 5099, 5101, 5107, 5113, 5119, 5147, 5153, 5167, 5171, 5179, 5189, 5197, 5209, 5227, 5231, 5233, 5237, 5261, 5273, 5279, 5281, 5297, 5303, 5309, 5323, 5333, 5347, 5351, 5381, 5387, 5393, 5399, 5407, 5413, 5417, 5419, 5431, 5437, 5441, 5443, 5449, 5471, 5477, 5479, 5483, 5501, 5503, 5507, 5519, 5521, 5527, 5531, 5557, 5563, 5569, 5573, 5581, 5591, 5623, 5639, 5641, 5647, 5651, 5653, 5657, 5659, 5669, 5683, 5689, 5693, 5701, 5711, 5717, 5737, 5741, 5743, 5749, 5779, 5783, 5791, 5801, 5807, 5813, 5821, 5827, 5839, 5843, 5849, 5851, 5857, 5861, 5867, 5869, 5879, 5881, 5897, 5903, 5923, 5927, 5939, 5953, 5981, 5987, 6007, 6011, 6029, 6037, 6043, 6047, 6053, 6067, 6073, 6079, 6089, 6091, 6101, 6113, 6121, 6131, 6133, 6143, 6151, 6163, 6173, 6197, 6199, 6203, 6211, 6217, 6221, 6229, 6247, 6257, 6263, 6269, 6271, 6277, 6287, 6299, 6301, 6311, 6317, 6323, 6329, 6337, 6343, 6353, 6359, 6361, 6367, 6373, 6379, 6389, 6397, 6421, 6427, 6449, 6451, 6469, 6473, 6481, 6491, 6521, 6529, 6547, 6551, 6553, 6563, 6569, 6571, 6577, 6581, 6599, 6607, 6619, 6637, 6653, 6659, 6661, 6673, 6679, 6689, 6691, 6701, 6703, 6709, 6719, 6733, 6737, 6761, 6763, 6779, 6781, 6791, 6793, 6803, 6823, 6827, 6829, 6833, 6841, 6857, 6863, 6869, 6871, 6883, 6899, 6907, 6911, 6917, 6947, 6949, 6959, 6961, 6967, 6971, 6977, 6983, 6991, 6997, 7001, 7013, 7019, 7027, 7039, 7043, 7057, 7069, 7079, 7103, 7109, 7121, 7127, 7129, 7151, 7159, 7177, 7187, 7193, 7207, 7211, 7213, 7219, 7229, 7237, 7243, 7247, 7253, 7283, 7297, 7307, 7309, 7321, 7331, 7333, 7349, 7351, 7369, 7393, 7411, 7417, 7433, 7451, 7457, 7459, 7477, 7481, 7487, 7489, 7499, 7507, 7517, 7523, 7529, 7537, 7541, 7547, 7549, 7559, 7561, 7573, 7577, 7583, 7589, 7591, 7603, 7607, 7621, 7639, 7643, 7649, 7669, 7673, 7681, 7687, 7691, 7699, 7703, 7717, 7723, 7727, 7741, 7753, 7757, 7759, 7789, 7793, 7817, 7823, 7829, 7841, 7853, 7867, 7873, 7877, 7879, 7883, 7901, 7907, 7919};
+native_uint_t Montgomery::subtractModulus(native_uint_t * a) const {
+  native_uint_t borrow = 0;
+  for (int i = 0; i < m_numberOfDigits; i++) {
+    native_uint_t difference = a[i] - m_modulus[i];
+    native_uint_t newBorrow = a[i] < m_modulus[i];
+    newBorrow += difference < borrow;
+    a[i] = difference - borrow;
+    borrow = newBorrow;
+  }
+  return borrow;
+}
+
+void Montgomery::doubleInPlace(native_uint_t * a) const {
+  native_uint_t carry = 0;
+  for (int i = 0; i < m_numberOfDigits; i++) {
+    native_uint_t newCarry = a[i] >> 31;
+    a[i] = (a[i] << 1) | carry;
+    carry = newCarry;
+  }
+  if (carry != 0 || compare(a, m_modulus) >= 0) {
+    subtractModulus(a);
+  }
+}
+
+Arithmetic::Primality Arithmetic::PrimalityOf(const Integer & i) {
+  Integer n = i;
+  n.setNegative(false);
+  if (n.isLowerThan(Integer(2))) {
+    return Primality::Composite;
+  }
+  for (int k = 0; k < k_numberOfPrimeFactors; k++) {
+    int p = primeFactors[k];
+    if (n.isLowerThan(Integer(p*p))) {
+      return Primality::Prime;
+    }
+    if (Remainder(n, p) == 0) {
+      return n.isEqualTo(Integer(p)) ? Primality::Prime : Primality::Composite;
+    }
+  }
+  if (n.m_numberOfDigits > k_maxNumberOfDigitsToFactorize) {
+    /* Too big to be tested, n is then treated as a composite, which the
+     * factorization gives up splitting. */
+    return Primality::Composite;
+  }
+  /* Miller-Rabin test: write n-1 = d*2^s with d odd. If n is prime, for any a,
+   * either a^d = 1 mod n or a^(d*2^r) = -1 mod n for some 0 <= r < s. */
+  Montgomery modulus(n.digits(), n.m_numberOfDigits);
+  Integer d = Integer::Subtraction(n, Integer(1));
+  int s = 0;
+  while ((d.digit(0) & 1) == 0) {
+    d = Integer::Division(d, Integer(2)).quotient;
+    s++;
+  }
+  native_uint_t minusOne[Montgomery::k_maxNumberOfDigits];
+  memset(minusOne, 0, modulus.numberOfDigits()*sizeof(native_uint_t));
+  modulus.subtract(minusOne, modulus.one(), minusOne);
+  for (int k = 0; k < k_numberOfMillerRabinBases; k++) {
+    native_uint_t a[Montgomery::k_maxNumberOfDigits];
+    memset(a, 0, modulus.numberOfDigits()*sizeof(native_uint_t));
+    a[0] = primeFactors[k];
+    modulus.toMontgomery(a, a);
+    modulus.power(a, d.digits(), d.m_numberOfDigits, a);
+    if (modulus.areEqual(a, modulus.one()) || modulus.areEqual(a, minusOne)) {
+      continue;
+    }
+    int r = 1;
+    while (r < s) {
+      modulus.multiply(a, a, a);
+      if (modulus.areEqual(a, minusOne)) {
+        break;
+      }
+      r++;
+    }
+    if (r == s) {
+      return Primality::Composite;
+    }
+  }
+  return n.isLowerThan(Integer("3317044064679887385961981")) ? Primality::Prime : Primality::ProbablePrime;
+}
+
+Integer Arithmetic::PollardRhoFactor(const Integer & n, int * remainingWork) {
+  /* Pollard's rho method with Brent's cycle detection: the sequence
+   * y -> y^2+c mod n is eventually periodic modulo any prime factor p of n,
+   * with a period around sqrt(p), which is detected by gcd(x-y, n). The
+   * products of the differences are accumulated to compute the gcd only every
+   * k_rhoGCDPeriod iterations. Return 1 when no factor was found within the
+   * remaining work. */
+  assert(n.m_numberOfDigits <= k_maxNumberOfDigitsToFactorize);
+  Montgomery modulus(n.digits(), n.m_numberOfDigits);
+  int numberOfDigits = modulus.numberOfDigits();
+  size_t residueSize = numberOfDigits*sizeof(native_uint_t);
+  int iterationWork = numberOfDigits*numberOfDigits;
+  for (native_uint_t c = 1; *remainingWork > 0; c++) {
+    native_uint_t x[Montgomery::k_maxNumberOfDigits];
+    native_uint_t y[Montgomery::k_maxNumberOfDigits];
+    native_uint_t ys[Montgomery::k_maxNumberOfDigits];
+    native_uint_t q[Montgomery::k_maxNumberOfDigits];
+    native_uint_t increment[Montgomery::k_maxNumberOfDigits];
+    native_uint_t difference[Montgomery::k_maxNumberOfDigits];
+    memset(increment, 0, residueSize);
+    increment[0] = c;
+    modulus.toMontgomery(increment, increment);
+    memcpy(y, modulus.one(), residueSize);
+    modulus.add(y, y, y);
+    memcpy(q, modulus.one(), residueSize);
+    Integer g(1);
+    int r = 1;
+    do {
+      memcpy(x, y, residueSize);
+      for (int i = 0; i < r; i++) {
+        modulus.multiply(y, y, y);
+        modulus.add(y, increment, y);
+      }
+      *remainingWork -= r*iterationWork;
+      int k = 0;
+      do {
+        memcpy(ys, y, residueSize);
+        int numberOfSteps = k_rhoGCDPeriod < r-k ? k_rhoGCDPeriod : r-k;
+        for (int i = 0; i < numberOfSteps; i++) {
+          modulus.multiply(y, y, y);
+          modulus.add(y, increment, y);
+          modulus.subtract(x, y, difference);
+          modulus.multiply(q, difference, q);
+        }
+        Integer product = IntegerWithDigits(q, numberOfDigits);
+        g = GCD(&product, &n);
+        k += numberOfSteps;
+        *remainingWork -= numberOfSteps*iterationWork;
+        if (*remainingWork <= 0 || Expression::shouldStopProcessing()) {
+          return Integer(1);
+        }
+      } while (k < r && g.isOne());
+      r *= 2;
+    } while (g.isOne());
+    if (g.isEqualTo(n)) {
+      /* Several factors were found during the last batch of products: redo it
+       * step by step. */
+      do {
+        modulus.multiply(ys, ys, ys);
+        modulus.add(ys, increment, ys);
+        modulus.subtract(x, ys, difference);
+        Integer d = IntegerWithDigits(difference, numberOfDigits);
+        g = GCD(&d, &n);
+      } while (g.isOne());
+    }
+    if (!g.isEqualTo(n)) {
+      return g;
+    }
+    // The cycles modulo all prime factors were detected together, change c
+  }
+  return Integer(1);
+}
+
+native_uint_t Arithmetic::Remainder(const Integer & a, Integer::half_native_uint_t b) {
+  // b fits in a half digit so the computations only need native digits
+  native_uint_t remainder = 0;
+  for (int i = a.numberOfHalfDigits()-1; i >= 0; i--) {
+    remainder = ((remainder << 16) | a.halfDigit(i)) % b;
+  }
+  return remainder;
+}
+
+Integer Arithmetic::IntegerWithDigits(const native_uint_t * digits, int numberOfDigits) {
+  while (numberOfDigits > 1 && digits[numberOfDigits-1] == 0) {
+    numberOfDigits--;
+  }
+  native_uint_t * integerDigits = new native_uint_t [numberOfDigits];
+  memcpy(integerDigits, digits, numberOfDigits*sizeof(native_uint_t));
+  return Integer(integerDigits, numberOfDigits, false);
+}
 
-// we can go to 7907*7907 = 62 520 649
 void Arithmetic::PrimeFactorization(const Integer * n, Integer * outputFactors, Integer * outputCoefficients, int outputLength) {
   /* First we look for prime divisors in the table primeFactors (to speed up
-   * the prime factorization for low numbers). When k_numberOfPrimeFactors is
-   * overflow, try every number as divisor. */
+   * the prime factorization for low numbers). The remaining cofactor is then
+   * broken into primes with Pollard-Brent's rho method. */
   Integer m = *n;
   m.setNegative(false);
   if (m.isEqualTo(Integer(1))) {
     return;
   }
-  const Integer primorial32("525896479052627740771371797072411912900610967452630");
-  if (primorial32.isLowerThan(m)) {
-    /* Special case 1: We do not want to break i in prime factor because it
-     * might take too many factors... More than k_maxNumberOfPrimeFactors.
-     * outputCoefficients[0] is set to -1 to indicate a special case. */
-    outputCoefficients[0] = Integer(-1);
-    return;
-  }
   for (int index = 0; index < outputLength; index++) {
     outputCoefficients[index] = Integer(0);
   }
 
   int t = 0; // n prime factor index
-  int k = 0; // prime factor index
-  Integer testedPrimeFactor = Integer(primeFactors[k]); // prime factor
-  outputFactors[t] = testedPrimeFactor;
-  IntegerDivision d = {.quotient = 0, .remainder = 0};
-  bool stopCondition;
-  do {
-    stopCondition = Integer::Power(outputFactors[t], Integer(2)).isLowerThan(m);
-    d = Integer::Division(m, testedPrimeFactor);
-    if (d.remainder.isEqualTo(Integer(0))) {
+  for (int k = 0; k < k_numberOfPrimeFactors && !m.isLowerThan(Integer(primeFactors[k]*primeFactors[k])); k++) {
+    if (Remainder(m, primeFactors[k]) != 0) {
+      continue;
+    }
+    if (t >= outputLength) {
+      /* Special case 1: i has more than outputLength prime factors.
+       * outputCoefficients[0] is set to -1 to indicate a special case. */
+      outputCoefficients[0] = Integer(-1);
+      return;
+    }
+    Integer testedPrimeFactor = Integer(primeFactors[k]);
+    IntegerDivision d = Integer::Division(m, testedPrimeFactor);
+    do {
       outputCoefficients[t] = Integer::Addition(outputCoefficients[t], Integer(1));
       m = std::move(d.quotient);
-      if (m.isEqualTo(Integer(1))) {
+      d = Integer::Division(m, testedPrimeFactor);
+    } while (d.remainder.isZero());
+    outputFactors[t++] = std::move(testedPrimeFactor);
+  }
+  if (m.isOne()) {
+    return;
+  }
+  int firstCofactorIndex = t;
+  // Composite factors of m that remain to be split
+  Integer composites[k_maxNumberOfPrimeFactors];
+  int numberOfComposites = 0;
+  composites[numberOfComposites++] = std::move(m);
+  int remainingWork = k_maxFactorizationWork;
+  while (numberOfComposites > 0) {
+    Integer c = std::move(composites[--numberOfComposites]);
+    Primality primality = PrimalityOf(c);
+    if (primality == Primality::ProbablePrime) {
+      /* Special case 3: c is probably prime but this cannot be proven.
+       * outputCoefficients[0] is set to -1 to indicate a special case. */
+      outputCoefficients[0] = Integer(-1);
+      return;
+    }
+    if (primality == Primality::Prime) {
+      // Insert c among the sorted factors of the cofactor
+      int index = firstCofactorIndex;
+      while (index < t && outputFactors[index].isLowerThan(c)) {
+        index++;
+      }
+      if (index < t && outputFactors[index].isEqualTo(c)) {
+        outputCoefficients[index] = Integer::Addition(outputCoefficients[index], Integer(1));
+        continue;
+      }
+      if (t >= outputLength) {
+        outputCoefficients[0] = Integer(-1);
         return;
       }
+      for (int j = t; j > index; j--) {
+        outputFactors[j] = std::move(outputFactors[j-1]);
+        outputCoefficients[j] = std::move(outputCoefficients[j-1]);
+      }
+      outputFactors[index] = std::move(c);
+      outputCoefficients[index] = Integer(1);
+      t++;
       continue;
     }
-    if (!outputCoefficients[t].isEqualTo(Integer(0))) {
-      t++;
+    Integer factor = c.m_numberOfDigits <= k_maxNumberOfDigitsToFactorize ? PollardRhoFactor(c, &remainingWork) : Integer(1);
+    if (factor.isOne() || numberOfComposites+2 > k_maxNumberOfPrimeFactors) {
+      /* Special case 2: We do not want to break i in prime factor because it
+       * takes too much time.
+       * outputCoefficients[0] is set to -1 to indicate a special case. */
+      outputCoefficients[0] = Integer(-1);
+      return;
     }
-    k++;
-    testedPrimeFactor = k < k_numberOfPrimeFactors ? Integer(primeFactors[k]) : Integer::Addition(testedPrimeFactor, Integer(1));
-    outputFactors[t] = testedPrimeFactor;
-  } while (stopCondition && testedPrimeFactor.isLowerThan(Integer(k_biggestPrimeFactor)));
-  if (Integer::Power(Integer(k_biggestPrimeFactor), Integer(2)).isLowerThan(m)) {
-    /* Special case 2: We do not want to break i in prime factor because it
-     * take too much time: the prime factor that should be tested is above
-     * k_biggestPrimeFactor.
-     * outputCoefficients[0] is set to -1 to indicate a special case. */
-    outputCoefficients[0] = -1;
-    return;
+    composites[numberOfComposites++] = Integer::Division(c, factor).quotient;
+    composites[numberOfComposites++] = std::move(factor);
   }
-  outputFactors[t] = std::move(m);
-  outputCoefficients[t] = Integer::Addition(outputCoefficients[t], Integer(1));
-}
 }
 
-
+}
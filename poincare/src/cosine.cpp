@@ -4,6 +4,7 @@
 #include <poincare/rational.h>
 #include <poincare/multiplication.h>
 #include <poincare/simplification_engine.h>
+#include <poincare/sine.h>
 #include <ion.h>
 extern "C" {
 #include <assert.h>
@@ -25,6 +26,16 @@ float Cosine::characteristicXRange(Context & context, AngleUnit angleUnit) const
   return Trigonometry::characteristicXRange(this, context, angleUnit);
 }
 
+RealInterval Cosine::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  RealInterval angle = operand(0)->privateApproximateInterval(symbol, x, context, angleUnit);
+  return RealInterval::Cosine(Trigonometry::ConvertToRadian(angle, angleUnit));
+}
+
+DualNumber Cosine::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber angle = Trigonometry::ConvertToRadian(operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit), angleUnit);
+  return DualNumber::Composition(angle, computeOnComplex<double>(angle.value()), -std::sin(angle.value()));
+}
+
 template<typename T>
 std::complex<T> Cosine::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> angleInput = Trigonometry::ConvertToRadian(c, angleUnit);
@@ -46,4 +57,14 @@ Expression * Cosine::shallowReduce(Context& context, AngleUnit angleUnit) {
   return Trigonometry::shallowReduceDirectFunction(this, context, angleUnit);
 }
 
+Expression * Cosine::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * angleDerivative = Trigonometry::CreateRadianAngleDerivative(operand(0), symbol, angleUnit);
+  if (angleDerivative == nullptr) {
+    return nullptr;
+  }
+  // cos(u)' = -sin(u)*u'
+  const Expression * multOperands[3] = {new Rational(-1), new Sine(operand(0), true), angleDerivative};
+  return new Multiplication(multOperands, 3, false);
+}
+
 }
@@ -246,9 +246,14 @@ Expression * Decimal::shallowReduce(Context& context, AngleUnit angleUnit) {
   return replaceWith(new Rational(numerator, denominator), true);
 }
 
+Expression * Decimal::createDerivative(char symbol, AngleUnit angleUnit) const {
+  return new Rational(0);
+}
+
 Expression * Decimal::shallowBeautify(Context & context, AngleUnit angleUnit) {
   if (m_mantissa.isNegative()) {
     m_mantissa.setNegative(false);
+    invalidateHash();
     Opposite * o = new Opposite(this, true);
     return replaceWith(o, true);
   }
@@ -277,6 +282,12 @@ int Decimal::simplificationOrderSameType(const Expression * e, bool canBeInterru
   return ((int)sign())*unsignedComparison;
 }
 
+uint32_t Decimal::computeHash() const {
+  uint32_t hash = CombineHash(0, (uint32_t)type());
+  hash = CombineHash(hash, m_mantissa.hash());
+  return CombineHash(hash, (uint32_t)m_exponent);
+}
+
 template Decimal::Decimal(double);
 template Decimal::Decimal(float);
 
@@ -39,8 +39,32 @@ Expression * Derivative::shallowReduce(Context& context, AngleUnit angleUnit) {
     return replaceWith(new Undefined(), true);
   }
 #endif
-  // TODO: to be implemented diff(+) -> +diff() etc
-  return this;
+  bool isAbscissaX = operand(1)->type() == Type::Symbol && static_cast<const Symbol *>(operand(1))->name() == 'x';
+  /* The derivative is evaluated at the abscissa by replacing x: this would
+   * also replace the variables of integrals and derivatives. */
+  if (!isAbscissaX && operand(0)->recursivelyMatches([](const Expression * e, Context & context) {
+        return e->type() == Type::Integral || e->type() == Type::Derivative;
+      }, context)) {
+    return this;
+  }
+  if (!isAbscissaX) {
+    /* Outside the real domain of f, f'(a) may be defined while the derivative
+     * is not: the numerical derivative returns undef at such points. When the
+     * abscissa is x, the reduced derivative does not carry the domain of f
+     * (diff(ln(x),x) = 1/x), so its evaluation has to check f first. */
+    double abscissa = operand(1)->approximateToScalar<double>(context, angleUnit);
+    if (std::isnan(operand(0)->approximateWithValueForSymbol('x', abscissa, context, angleUnit))) {
+      return this;
+    }
+  }
+  Expression * derivative = operand(0)->createDerivative('x', angleUnit);
+  if (derivative == nullptr) {
+    return this;
+  }
+  if (!isAbscissaX) {
+    Expression::ReplaceSymbolWithExpression(&derivative, 'x', editableOperand(1));
+  }
+  return replaceWith(derivative, true)->deepReduce(context, angleUnit);
 }
 
 template<typename T>
@@ -50,16 +74,32 @@ Complex<T> * Derivative::templatedApproximate(Context& context, AngleUnit angleU
   Evaluation<T> * xInput = operand(1)->privateApproximate(T(), context, angleUnit);
   T x = xInput->toScalar();
   delete xInput;
-  T functionValue = operand(0)->approximateWithValueForSymbol('x', x, context, angleUnit);
-  // No complex/matrix version of Derivative
-  if (std::isnan(x) || std::isnan(functionValue)) {
+  if (std::isnan(x)) {
+    return new Complex<T>(Complex<T>::Undefined());
+  }
+  // Elementary functions are differentiated exactly by propagating dual numbers
+  DualNumber dual = operand(0)->privateApproximateWithDerivative('x', DualNumber::Variable(x), context, angleUnit);
+  if (dual.isSingular()) {
+    return new Complex<T>(Complex<T>::Undefined());
+  }
+  if (dual.isDifferentiable() && dual.derivative().imag() == 0.0) {
+    // No complex/matrix version of Derivative
+    if (dual.value().imag() != 0.0 || std::isnan(dual.value().real())) {
+      return new Complex<T>(Complex<T>::Undefined());
+    }
+    return new Complex<T>(dual.derivative().real());
+  }
+  // The function is compiled once for all the evaluations of Ridders' algorithm
+  ApproximationProgram<T> function(operand(0), 'x', context, angleUnit);
+  T functionValue = function.approximateWithValueForSymbol(x, context);
+  if (std::isnan(functionValue)) {
     return new Complex<T>(Complex<T>::Undefined());
   }
 
   T error, result;
   T h = k_minInitialRate;
   do {
-    result = riddersApproximation(context, angleUnit, x, h, &error);
+    result = riddersApproximation(function, context, x, h, &error);
     h /= 10.0;
   } while ((std::fabs(error/result) > k_maxErrorRateOnApproximation || std::isnan(error)) && h >= epsilon);
 
@@ -75,14 +115,14 @@ Complex<T> * Derivative::templatedApproximate(Context& context, AngleUnit angleU
 }
 
 template<typename T>
-T Derivative::growthRateAroundAbscissa(T x, T h, Context & context, AngleUnit angleUnit) const {
-  T expressionPlus = operand(0)->approximateWithValueForSymbol('x', x+h, context, angleUnit);
-  T expressionMinus = operand(0)->approximateWithValueForSymbol('x', x-h, context, angleUnit);
+T Derivative::growthRateAroundAbscissa(T x, T h, const ApproximationProgram<T> & function, Context & context) const {
+  T expressionPlus = function.approximateWithValueForSymbol(x+h, context);
+  T expressionMinus = function.approximateWithValueForSymbol(x-h, context);
   return (expressionPlus - expressionMinus)/(2*h);
 }
 
 template<typename T>
-T Derivative::riddersApproximation(Context & context, AngleUnit angleUnit, T x, T h, T * error) const {
+T Derivative::riddersApproximation(const ApproximationProgram<T> & function, Context & context, T x, T h, T * error) const {
   /* Ridders' Algorithm
    * Blibliography:
    * - Ridders, C.J.F. 1982, Advances in Engineering Software, vol. 4, no. 2,
@@ -102,7 +142,7 @@ T Derivative::riddersApproximation(Context & context, AngleUnit angleUnit, T x,
       a[i][j] = 1;
     }
   }
-  a[0][0] = growthRateAroundAbscissa(x, hh, context, angleUnit);
+  a[0][0] = growthRateAroundAbscissa(x, hh, function, context);
   T ans = 0;
   T errt = 0;
   /* Loop on i: change the step size */
@@ -111,7 +151,7 @@ T Derivative::riddersApproximation(Context & context, AngleUnit angleUnit, T x,
     /* Make hh an exactly representable number */
     volatile T temp =  x+hh;
     hh = temp - x;
-    a[0][i] = growthRateAroundAbscissa(x, hh, context, angleUnit);
+    a[0][i] = growthRateAroundAbscissa(x, hh, function, context);
     T fac = k_rateStepSize*k_rateStepSize;
     /* Loop on j: compute extrapolation for several orders */
     for (int j = 1; j < 10; j++) {
@@ -10,6 +10,7 @@ extern "C" {
 #include <poincare/tangent.h>
 #include <poincare/multiplication.h>
 #include <poincare/opposite.h>
+#include <poincare/subtraction.h>
 #include "layout/fraction_layout.h"
 #include <cmath>
 
@@ -48,6 +49,29 @@ Expression * Division::shallowReduce(Context& context, AngleUnit angleUnit) {
   return m->shallowReduce(context, angleUnit);
 }
 
+Expression * Division::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * numeratorDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  Expression * denominatorDerivative = operand(1)->createDerivative(symbol, angleUnit);
+  if (numeratorDerivative == nullptr || denominatorDerivative == nullptr) {
+    delete numeratorDerivative;
+    delete denominatorDerivative;
+    return nullptr;
+  }
+  // (u/v)' = (u'*v-u*v')/v^2
+  Multiplication * firstTerm = new Multiplication(numeratorDerivative, operand(1)->clone(), false);
+  Multiplication * secondTerm = new Multiplication(operand(0)->clone(), denominatorDerivative, false);
+  Power * squaredDenominator = new Power(operand(1), new Rational(2), false);
+  return new Division(new Subtraction(firstTerm, secondTerm, false), squaredDenominator, false);
+}
+
+RealInterval Division::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  return RealInterval::Division(operand(0)->privateApproximateInterval(symbol, x, context, angleUnit), operand(1)->privateApproximateInterval(symbol, x, context, angleUnit));
+}
+
+DualNumber Division::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  return DualNumber::Division(operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit), operand(1)->privateApproximateWithDerivative(symbol, x, context, angleUnit));
+}
+
 template<typename T>
 std::complex<T> Division::compute(const std::complex<T> c, const std::complex<T> d) {
   return c/d;
@@ -59,7 +83,7 @@ ExpressionLayout * Division::createLayout(PrintFloat::Mode floatDisplayMode, int
   return new FractionLayout(numerator->createLayout(floatDisplayMode, numberOfSignificantDigits), denominator->createLayout(floatDisplayMode, numberOfSignificantDigits), false);
 }
 
-template<typename T> MatrixComplex<T> Division::computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> n) {
+template<typename T> MatrixComplex<T> Division::computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> & n) {
   MatrixComplex<T> * inverse = n.createInverse();
   if (inverse == nullptr) {
     return MatrixComplex<T>::Undefined();
@@ -69,7 +93,7 @@ template<typename T> MatrixComplex<T> Division::computeOnComplexAndMatrix(const
   return result;
 }
 
-template<typename T> MatrixComplex<T> Division::computeOnMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n) {
+template<typename T> MatrixComplex<T> Division::computeOnMatrices(const MatrixComplex<T> & m, const MatrixComplex<T> & n) {
   if (m.numberOfColumns() != n.numberOfColumns()) {
     return MatrixComplex<T>::Undefined();
   }
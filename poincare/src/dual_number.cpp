@@ -0,0 +1,67 @@
+#include <poincare/dual_number.h>
+
+namespace Poincare {
+
+DualNumber DualNumber::Opposite(DualNumber a) {
+  return DualNumber(-a.m_value, -a.m_derivative);
+}
+
+DualNumber DualNumber::Addition(DualNumber a, DualNumber b) {
+  if (a.isSingular() || b.isSingular()) {
+    // Two kinks may cancel each other out
+    return a.isDifferentiable() || b.isDifferentiable() ? Singular(a.m_value + b.m_value) : Undifferentiable();
+  }
+  return DualNumber(a.m_value + b.m_value, a.m_derivative + b.m_derivative);
+}
+
+DualNumber DualNumber::Subtraction(DualNumber a, DualNumber b) {
+  if (a.isSingular() || b.isSingular()) {
+    return a.isDifferentiable() || b.isDifferentiable() ? Singular(a.m_value - b.m_value) : Undifferentiable();
+  }
+  return DualNumber(a.m_value - b.m_value, a.m_derivative - b.m_derivative);
+}
+
+DualNumber DualNumber::Multiplication(DualNumber a, DualNumber b) {
+  if (a.isSingular() || b.isSingular()) {
+    // (a*b)' = a'*b+a*b' keeps the kink of a unless b vanishes
+    bool singular = (a.isSingular() && b.isDifferentiable() && b.m_value != 0.0) || (b.isSingular() && a.isDifferentiable() && a.m_value != 0.0);
+    return singular ? Singular(a.m_value*b.m_value) : Undifferentiable();
+  }
+  if (!a.isDifferentiable() || !b.isDifferentiable()) {
+    return Undifferentiable();
+  }
+  return DualNumber(a.m_value*b.m_value, a.m_derivative*b.m_value + a.m_value*b.m_derivative);
+}
+
+DualNumber DualNumber::Division(DualNumber a, DualNumber b) {
+  if (a.isSingular() || b.isSingular()) {
+    bool singular = (a.isSingular() && b.isDifferentiable() && b.m_value != 0.0) || (b.isSingular() && a.isDifferentiable() && a.m_value != 0.0);
+    return singular ? Singular(a.m_value/b.m_value) : Undifferentiable();
+  }
+  if (!a.isDifferentiable() || !b.isDifferentiable()) {
+    return Undifferentiable();
+  }
+  // (a/b)' = (a'*b-a*b')/b^2
+  return DualNumber(a.m_value/b.m_value, (a.m_derivative*b.m_value - a.m_value*b.m_derivative)/(b.m_value*b.m_value));
+}
+
+DualNumber DualNumber::Composition(DualNumber a, std::complex<double> value, std::complex<double> derivative) {
+  bool isDerivativeFinite = std::isfinite(derivative.real()) && std::isfinite(derivative.imag());
+  if (a.isSingular()) {
+    // f(a) keeps the kink of a unless f flattens it
+    return isDerivativeFinite && derivative != 0.0 ? Singular(value) : Undifferentiable();
+  }
+  if (!a.isDifferentiable()) {
+    return Undifferentiable();
+  }
+  if (a.isConstant()) {
+    // f'(a) may be undefined where f is not differentiable
+    return Constant(value);
+  }
+  if (std::isinf(derivative.real())) {
+    return Singular(value);
+  }
+  return DualNumber(value, derivative*a.m_derivative);
+}
+
+}
@@ -54,6 +54,7 @@ void DynamicHierarchy::addOperands(const Expression * const * operands, int numb
   delete[] m_operands;
   m_operands = newOperands;
   m_numberOfOperands += numberOfOperands;
+  invalidateHash();
 }
 
 void DynamicHierarchy::mergeOperands(DynamicHierarchy * d) {
@@ -82,6 +83,7 @@ void DynamicHierarchy::addOperandAtIndex(Expression * operand, int index) {
   delete[] m_operands;
   m_operands = newOperands;
   m_numberOfOperands += 1;
+  invalidateHash();
 }
 
 void DynamicHierarchy::removeOperand(const Expression * e, bool deleteAfterRemoval) {
@@ -97,24 +99,64 @@ void DynamicHierarchy::removeOperand(const Expression * e, bool deleteAfterRemov
 
 
 void DynamicHierarchy::sortOperands(ExpressionOrder order, bool canBeInterrupted) {
-  for (int i = numberOfOperands()-1; i > 0; i--) {
-    bool isSorted = true;
-    for (int j = 0; j < numberOfOperands()-1; j++) {
-      /* Warning: Matrix operations are not always commutative (ie,
-       * multiplication) so we never swap 2 matrices. */
+  /* Bottom-up merge sort: it is stable like the bubble sort it replaces and
+   * only moves operand pointers, whose parent is unchanged. */
+  int n = m_numberOfOperands;
+  if (n < 2) {
+    return;
+  }
+  const Expression ** source = m_operands;
+  const Expression ** destination = new const Expression * [n];
+  for (int width = 1; width < n; width *= 2) {
+    for (int start = 0; start < n; start += 2*width) {
+      int middle = start+width < n ? start+width : n;
+      int end = start+2*width < n ? start+2*width : n;
+      MergeOperands(source, destination, start, middle, end, order, canBeInterrupted);
+    }
+    const Expression ** temp = source;
+    source = destination;
+    destination = temp;
+  }
+  // The sorted operands are in source, destination is the other buffer
+  delete[] destination;
+  m_operands = source;
+  invalidateHash();
+}
+
+void DynamicHierarchy::MergeOperands(const Expression ** source, const Expression ** destination, int start, int middle, int end, ExpressionOrder order, bool canBeInterrupted) {
 #if MATRIX_EXACT_REDUCING
-      if (order(operand(j), operand(j+1), canBeInterrupted) > 0 && (!operand(j)->recursivelyMatches(Expression::IsMatrix) || !operand(j+1)->recursivelyMatches(Expression::IsMatrix))) {
+  /* Warning: Matrix operations are not always commutative (ie,
+   * multiplication) so we never swap 2 matrices: a matrix of the right run
+   * cannot go before a matrix of the left run. */
+  int numberOfLeftMatrices = 0;
+  for (int k = start; k < middle; k++) {
+    numberOfLeftMatrices += source[k]->recursivelyMatches(Expression::IsMatrix);
+  }
+#endif
+  int i = start;
+  int j = middle;
+  int k = start;
+  while (i < middle && j < end) {
+#if MATRIX_EXACT_REDUCING
+    bool takeRight = !(numberOfLeftMatrices > 0 && source[j]->recursivelyMatches(Expression::IsMatrix)) && order(source[i], source[j], canBeInterrupted) > 0;
 #else
-      if (order(operand(j), operand(j+1), canBeInterrupted) > 0) {
+    bool takeRight = order(source[i], source[j], canBeInterrupted) > 0;
 #endif
-        swapOperands(j, j+1);
-        isSorted = false;
-      }
-    }
-    if (isSorted) {
-      return;
+    if (takeRight) {
+      destination[k++] = source[j++];
+    } else {
+#if MATRIX_EXACT_REDUCING
+      numberOfLeftMatrices -= source[i]->recursivelyMatches(Expression::IsMatrix);
+#endif
+      destination[k++] = source[i++];
     }
   }
+  while (i < middle) {
+    destination[k++] = source[i++];
+  }
+  while (j < end) {
+    destination[k++] = source[j++];
+  }
 }
 
 Expression * DynamicHierarchy::squashUnaryHierarchy() {
@@ -139,6 +181,7 @@ void DynamicHierarchy::removeOperandAtIndex(int i, bool deleteAfterRemoval) {
   for (int j=i; j<m_numberOfOperands; j++) {
     m_operands[j] = m_operands[j+1];
   }
+  invalidateHash();
 }
 
 int DynamicHierarchy::simplificationOrderSameType(const Expression * e, bool canBeInterrupted) const {
@@ -161,6 +204,14 @@ int DynamicHierarchy::simplificationOrderSameType(const Expression * e, bool can
   return 0;
 }
 
+uint32_t DynamicHierarchy::computeHash() const {
+  uint32_t hash = CombineHash(0, (uint32_t)type());
+  for (int i = 0; i < m_numberOfOperands; i++) {
+    hash = CombineHash(hash, m_operands[i]->hash());
+  }
+  return hash;
+}
+
 int DynamicHierarchy::simplificationOrderGreaterType(const Expression * e, bool canBeInterrupted) const {
   int m = numberOfOperands();
   if (m == 0) {
@@ -5,6 +5,7 @@ extern "C" {
 }
 #include <poincare/evaluation.h>
 #include <poincare/division.h>
+#include <poincare/linear_algebra.h>
 #include <poincare/matrix.h>
 #include <poincare/expression.h>
 #include <poincare/undefined.h>
@@ -119,7 +120,7 @@ MatrixComplex<T>::MatrixComplex(std::complex<T> * operands, int numberOfRows, in
   m_numberOfRows(numberOfRows),
   m_numberOfColumns(numberOfColumns)
 {
-  m_operands = new std::complex<T> [numberOfRows*numberOfColumns];
+  allocateOperands(numberOfRows*numberOfColumns);
   for (int i=0; i<numberOfRows*numberOfColumns; i++) {
     m_operands[i] = operands[i];
     if (m_operands[i].real() == -0.0) {
@@ -133,22 +134,14 @@ MatrixComplex<T>::MatrixComplex(std::complex<T> * operands, int numberOfRows, in
 
 template<typename T>
 MatrixComplex<T>::~MatrixComplex() {
-  if (m_operands != nullptr) {
+  if (m_operands != nullptr && !usesInlineOperands()) {
     delete [] m_operands;
   }
 }
 
 template<typename T>
 MatrixComplex<T>::MatrixComplex(MatrixComplex&& other) {
-  // Pilfer other's data
-  m_operands = other.m_operands;
-  m_numberOfRows = other.m_numberOfRows;
-  m_numberOfColumns = other.m_numberOfColumns;
-
-  // Reset other
-  other.m_operands = nullptr;
-  other.m_numberOfRows = 0;
-  other.m_numberOfColumns = 0;
+  pilferOperands(other);
 }
 
 template<typename T>
@@ -156,30 +149,46 @@ MatrixComplex<T>::MatrixComplex(const MatrixComplex& other) {
   // Copy other's data
   m_numberOfRows = other.m_numberOfRows;
   m_numberOfColumns = other.m_numberOfColumns;
-  std::complex<T> * operands = new std::complex<T> [m_numberOfRows*m_numberOfColumns];
+  allocateOperands(m_numberOfRows*m_numberOfColumns);
   for (int i=0; i<m_numberOfRows*m_numberOfColumns; i++) {
-    operands[i] = other.m_operands[i];
+    m_operands[i] = other.m_operands[i];
   }
-  m_operands = operands;
 }
 
 template<typename T>
 MatrixComplex<T>& MatrixComplex<T>::operator=(MatrixComplex<T> && other) {
   if (this != &other) {
-    if (m_operands) { delete [] m_operands; }
-    // Pilfer other's ivars
-    m_operands = other.m_operands;
-    m_numberOfRows = other.m_numberOfRows;
-    m_numberOfColumns = other.m_numberOfColumns;
-
-    // Reset other
-    other.m_operands = nullptr;
-    other.m_numberOfRows = 0;
-    other.m_numberOfColumns = 0;
+    if (m_operands && !usesInlineOperands()) { delete [] m_operands; }
+    pilferOperands(other);
   }
   return *this;
 }
 
+template<typename T>
+void MatrixComplex<T>::allocateOperands(int numberOfOperands) {
+  m_operands = numberOfOperands <= k_maxNumberOfInlineOperands ? m_inlineOperands : new std::complex<T> [numberOfOperands];
+}
+
+template<typename T>
+void MatrixComplex<T>::pilferOperands(MatrixComplex & other) {
+  m_numberOfRows = other.m_numberOfRows;
+  m_numberOfColumns = other.m_numberOfColumns;
+  if (other.usesInlineOperands()) {
+    // Inline operands cannot be pilfered
+    m_operands = m_inlineOperands;
+    for (int i = 0; i < m_numberOfRows*m_numberOfColumns; i++) {
+      m_inlineOperands[i] = other.m_inlineOperands[i];
+    }
+  } else {
+    m_operands = other.m_operands;
+  }
+
+  // Reset other
+  other.m_operands = nullptr;
+  other.m_numberOfRows = 0;
+  other.m_numberOfColumns = 0;
+}
+
 template<typename T>
 Expression * MatrixComplex<T>::complexToExpression(Expression::ComplexFormat complexFormat) const {
   Expression ** operands = new Expression * [numberOfComplexOperands()];
@@ -213,8 +222,7 @@ std::complex<T> MatrixComplex<T>::createDeterminant() const {
   for (int i=0; i<m_numberOfRows*m_numberOfColumns; i++) {
     operandsCopy[i] = m_operands[i];
   }
-  std::complex<T> determinant = std::complex<T>(1);
-  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, &determinant);
+  std::complex<T> determinant = LinearAlgebra::Determinant(operandsCopy, m_numberOfRows);
   delete[] operandsCopy;
   return determinant;
 }
@@ -225,7 +233,7 @@ MatrixComplex<T> * MatrixComplex<T>::createInverse() const {
   for (int i=0; i<m_numberOfRows*m_numberOfColumns; i++) {
     operandsCopy[i] = m_operands[i];
   }
-  int result = Matrix::ArrayInverse(operandsCopy, m_numberOfRows, m_numberOfColumns);
+  int result = LinearAlgebra::Inverse(operandsCopy, m_numberOfRows, m_numberOfColumns);
   MatrixComplex<T> * inverse = nullptr;
   if (result == 0) {
     // Intentionally swapping dimensions for inverse, although it doesn't make a difference because it is square
@@ -0,0 +1,52 @@
+#include <poincare/evaluation_arena.h>
+#include <new>
+#include <assert.h>
+
+namespace Poincare {
+
+alignas(EvaluationArena::k_alignment) char EvaluationArena::s_buffer[EvaluationArena::k_size];
+size_t EvaluationArena::s_offset = 0;
+int EvaluationArena::s_depth = 0;
+
+EvaluationArena::Scope::Scope() :
+  m_offset(s_offset)
+{
+  s_depth++;
+}
+
+EvaluationArena::Scope::~Scope() {
+  assert(s_depth > 0);
+  s_depth--;
+  /* The offset may have moved below m_offset if the last block allocated
+   * before the scope was deleted within the scope: this block is free anyway. */
+  s_offset = m_offset;
+}
+
+void * EvaluationArena::Allocate(size_t size) {
+  size_t alignedSize = AlignedSize(size);
+  if (s_depth == 0 || s_offset + alignedSize > k_size) {
+    return ::operator new(size);
+  }
+  void * block = s_buffer + s_offset;
+  s_offset += alignedSize;
+  return block;
+}
+
+void EvaluationArena::Release(void * block, size_t size) {
+  if (!Contains(block)) {
+    ::operator delete(block);
+    return;
+  }
+  // Give back the memory of the last allocated block
+  size_t alignedSize = AlignedSize(size);
+  if (static_cast<char *>(block) + alignedSize == s_buffer + s_offset) {
+    s_offset -= alignedSize;
+  }
+}
+
+bool EvaluationArena::Contains(const void * block) {
+  const char * b = static_cast<const char *>(block);
+  return b >= s_buffer && b < s_buffer + k_size;
+}
+
+}
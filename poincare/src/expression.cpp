@@ -7,6 +7,7 @@
 #include <poincare/matrix_data.h>
 #include <poincare/undefined.h>
 #include <poincare/simplification_root.h>
+#include <poincare/simplification_cache.h>
 #include <poincare/evaluation.h>
 #include <poincare/opposite.h>
 #include <poincare/variable_context.h>
@@ -60,16 +61,24 @@ Expression * Expression::replaceSymbolWithExpression(char symbol, Expression * e
 
 static Expression::CircuitBreaker sCircuitBreaker = nullptr;
 static bool sSimplificationHasBeenInterrupted = false;
+static bool sHasProcessingDeadline = false;
+static uint64_t sProcessingDeadline = 0;
 
 void Expression::setCircuitBreaker(CircuitBreaker cb) {
   sCircuitBreaker = cb;
 }
 
+void Expression::setProcessingDeadline(uint64_t delayInMilliseconds) {
+  sHasProcessingDeadline = true;
+  sProcessingDeadline = Ion::Timing::millis() + delayInMilliseconds;
+}
+
+void Expression::clearProcessingDeadline() {
+  sHasProcessingDeadline = false;
+}
+
 bool Expression::shouldStopProcessing() {
-  if (sCircuitBreaker == nullptr) {
-    return false;
-  }
-  if (sCircuitBreaker()) {
+  if ((sHasProcessingDeadline && Ion::Timing::millis() >= sProcessingDeadline) || (sCircuitBreaker != nullptr && sCircuitBreaker())) {
     sSimplificationHasBeenInterrupted = true;
     return true;
   }
@@ -110,6 +119,7 @@ void Expression::replaceOperand(const Expression * oldOperand, Expression * newO
         const_cast<Expression *>(newOperand)->setParent(this);
       }
       op[i] = newOperand;
+      invalidateHash();
       break;
     }
   }
@@ -137,6 +147,7 @@ void Expression::detachOperandAtIndex(int i) {
     const_cast<Expression *>(op[i])->setParent(nullptr);
   }
   op[i] = nullptr;
+  invalidateHash();
 }
 
 void Expression::swapOperands(int i, int j) {
@@ -146,6 +157,7 @@ void Expression::swapOperands(int i, int j) {
   Expression * temp = op[i];
   op[i] = op[j];
   op[j] = temp;
+  invalidateHash();
 }
 
 bool Expression::hasAncestor(const Expression * e) const {
@@ -309,6 +321,39 @@ bool Expression::needParenthesisWithParent(const Expression * e) const {
 
 /* Comparison */
 
+uint32_t Expression::hash() const {
+  if (m_hash == 0) {
+    m_hash = computeHash();
+    // 0 stands for a hash not computed yet
+    if (m_hash == 0) {
+      m_hash = 1;
+    }
+  }
+  return m_hash;
+}
+
+void Expression::invalidateHash() {
+  /* A node whose hash is not computed has no ancestor whose hash is computed:
+   * the hashes of ancestors are computed from the hashes of their operands. */
+  Expression * e = this;
+  while (e != nullptr && e->m_hash != 0) {
+    e->m_hash = 0;
+    e = e->m_parent;
+  }
+}
+
+uint32_t Expression::CombineHash(uint32_t hash, uint32_t value) {
+  // FNV-1a on the 4 bytes of value
+  if (hash == 0) {
+    hash = 2166136261u;
+  }
+  for (int i = 0; i < 4; i++) {
+    hash ^= (value >> (8*i)) & 0xFF;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
 int Expression::SimplificationOrder(const Expression * e1, const Expression * e2, bool canBeInterrupted) {
   if (e1->type() > e2->type()) {
     if (canBeInterrupted && shouldStopProcessing()) {
@@ -343,14 +388,30 @@ bool Expression::isEqualToItsApproximationLayout(Expression * approximation, int
 /* Simplification */
 
 Expression * Expression::ParseAndSimplify(const char * text, Context & context, AngleUnit angleUnit) {
+  SimplificationCache * cache = context.simplificationCache();
+  if (cache != nullptr) {
+    Expression * cachedExpression = cache->simplifiedExpression(text, angleUnit);
+    if (cachedExpression != nullptr) {
+      return cachedExpression;
+    }
+  }
   Expression * exp = parse(text);
   if (exp == nullptr) {
     return new Undefined();
   }
+  /* The dependencies of the cache entry are read on the parsed expression, as
+   * the simplification may remove symbols (A-A). */
+  Expression * parsedExpression = cache != nullptr && SimplificationCache::CanStore(text, exp) ? exp->clone() : nullptr;
   Simplify(&exp, context, angleUnit);
   if (exp == nullptr) {
+    // The simplification has been interrupted: its result is not cached
+    delete parsedExpression;
     return parse(text);
   }
+  if (parsedExpression != nullptr) {
+    cache->store(text, angleUnit, parsedExpression, exp);
+    delete parsedExpression;
+  }
   return exp;
 }
 
@@ -413,6 +474,7 @@ Expression * Expression::deepBeautify(Context & context, AngleUnit angleUnit) {
 /* Evaluation */
 
 template<typename T> Expression * Expression::approximate(Context& context, AngleUnit angleUnit, ComplexFormat complexFormat) const {
+  EvaluationArena::Scope arenaScope;
   Evaluation<T> * e = privateApproximate(T(), context, angleUnit);
   Expression * result = e->complexToExpression(complexFormat);
   delete e;
@@ -420,6 +482,7 @@ template<typename T> Expression * Expression::approximate(Context& context, Angl
 }
 
 template<typename T> T Expression::approximateToScalar(Context& context, AngleUnit angleUnit) const {
+  EvaluationArena::Scope arenaScope;
   Evaluation<T> * evaluation = privateApproximate(T(), context, angleUnit);
   T result = evaluation->toScalar();
   /*if (evaluation->type() == Type::Matrix) {
@@ -484,8 +547,23 @@ Expression::Coordinate2D Expression::nextMinimumOfExpression(char symbol, double
   double x = start;
   bool endCondition = false;
   do {
+    if (lookForRootMinimum) {
+      /* Only minima whose value is zero are looked for: the steps over which
+       * the function stays away from zero are skipped. The search restarts on
+       * the last skipped step, which could bracket a minimum with the
+       * following ones. */
+      int numberOfSkippedSteps = 0;
+      while ((step > 0.0 ? x <= max : x >= max) && (numberOfSkippedSteps = numberOfStepsAwayFromZero(symbol, x, step, std::fabs(step)*k_solverPrecision, context, angleUnit, expression)) > 0) {
+        x += (numberOfSkippedSteps-1)*step;
+      }
+    }
     bracketMinimum(symbol, x, step, max, bracket, evaluate, context, angleUnit, expression);
-    result = brentMinimum(symbol, bracket[0], bracket[2], evaluate, context, angleUnit, expression);
+    // Brent method would only evaluate the function on NAN without bracket
+    if (std::isnan(bracket[0])) {
+      result = {.abscissa = NAN, .value = NAN};
+    } else {
+      result = brentMinimum(symbol, bracket[0], bracket[2], evaluate, context, angleUnit, expression);
+    }
     x = bracket[1];
     // Because of float approximation, exact zero is never reached
     if (std::fabs(result.abscissa) < std::fabs(step)*k_solverPrecision) {
@@ -641,7 +719,8 @@ double Expression::nextIntersectionWithExpression(char symbol, double start, dou
   double x = start+step;
   do {
     bracketRoot(symbol, x, step, max, bracket, evaluation, context, angleUnit, expression);
-    result = brentRoot(symbol, bracket[0], bracket[1], std::fabs(step/precisionByGradUnit), evaluation, context, angleUnit, expression);
+    // Brent method would only evaluate the function on NAN without bracket
+    result = std::isnan(bracket[0]) ? NAN : brentRoot(symbol, bracket[0], bracket[1], std::fabs(step/precisionByGradUnit), evaluation, context, angleUnit, expression);
     x = bracket[1];
   } while (std::isnan(result) && (step > 0.0 ? x <= max : x >= max));
 
@@ -675,8 +754,26 @@ double Expression::nextIntersectionWithExpression(char symbol, double start, dou
 void Expression::bracketRoot(char symbol, double start, double step, double max, double result[2], EvaluationAtAbscissa evaluation, Context & context, AngleUnit angleUnit, const Expression * expression) const {
   double a = start;
   double b = start+step;
+  double fa = evaluation(symbol, a, context, angleUnit, this, expression);
+  int numberOfStepsBeforeSkipping = 0;
   while (step > 0.0 ? b <= max : b >= max) {
-    double fa = evaluation(symbol, a, context, angleUnit, this, expression);
+    /* The steps over which the function cannot change sign are skipped without
+     * evaluating it. Abscissae are still computed step by step to remain the
+     * ones of the exhaustive search. After a failed attempt, a few steps are
+     * evaluated before trying again. */
+    if (numberOfStepsBeforeSkipping == 0) {
+      int numberOfSkippedSteps = numberOfStepsAwayFromZero(symbol, a, step, 0.0, context, angleUnit, expression);
+      if (numberOfSkippedSteps > 0) {
+        for (int i = 0; i < numberOfSkippedSteps; i++) {
+          a = b;
+          b = b+step;
+        }
+        fa = evaluation(symbol, a, context, angleUnit, this, expression);
+        continue;
+      }
+      numberOfStepsBeforeSkipping = k_minNumberOfSkippedSteps;
+    }
+    numberOfStepsBeforeSkipping--;
     double fb = evaluation(symbol, b, context, angleUnit, this, expression);
     if (fa*fb <= 0) {
       result[0] = a;
@@ -684,12 +781,32 @@ void Expression::bracketRoot(char symbol, double start, double step, double max,
       return;
     }
     a = b;
+    fa = fb;
     b = b+step;
   }
   result[0] = NAN;
   result[1] = NAN;
 }
 
+int Expression::numberOfStepsAwayFromZero(char symbol, double start, double step, double threshold, Context & context, AngleUnit angleUnit, const Expression * expression) const {
+  for (int n = k_maxNumberOfSkippedSteps; n >= k_minNumberOfSkippedSteps; n /= 4) {
+    /* The interval is widened by half a step to enclose the abscissa reached
+     * by adding n steps despite rounding errors, and by the precision under
+     * which abscissae are rounded to 0 by the solver. */
+    double end = start+(n+0.5)*step;
+    double margin = std::fabs(step)*k_solverPrecision;
+    double lower = (start < end ? start : end) - margin;
+    double upper = (start < end ? end : start) + margin;
+    RealInterval enclosure = approximateIntervalForSymbol(symbol, lower, upper, context, angleUnit);
+    if (expression != nullptr) {
+      enclosure = RealInterval::Subtraction(enclosure, expression->approximateIntervalForSymbol(symbol, lower, upper, context, angleUnit));
+    }
+    if (enclosure.isAwayFromZero(threshold)) {
+      return n;
+    }
+  }
+  return 0;
+}
 
 double Expression::brentRoot(char symbol, double ax, double bx, double precision, EvaluationAtAbscissa evaluation, Context & context, AngleUnit angleUnit, const Expression * expression) const {
   if (ax > bx) {
@@ -764,6 +881,51 @@ double Expression::brentRoot(char symbol, double ax, double bx, double precision
   return NAN;
 }
 
+RealInterval Expression::approximateIntervalForSymbol(char symbol, double lower, double upper, Context & context, AngleUnit angleUnit) const {
+  return privateApproximateInterval(symbol, RealInterval(lower, upper), context, angleUnit);
+}
+
+RealInterval Expression::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  if (approximationDependsOnSymbol(symbol, context)) {
+    return RealInterval::Unbounded();
+  }
+  /* The expression does not depend on the symbol: its approximation is its own
+   * enclosure. A non-real value may become real again in the parent node. */
+  Evaluation<double> * evaluation = privateApproximate(DoublePrecision(), context, angleUnit);
+  RealInterval result = RealInterval::Unbounded();
+  if (evaluation->type() == Evaluation<double>::Type::Complex) {
+    std::complex<double> value = *static_cast<Complex<double> *>(evaluation);
+    if (std::isnan(value.real()) && std::isnan(value.imag())) {
+      result = RealInterval::Undefined();
+    } else if (value.imag() == 0.0) {
+      result = std::isnan(value.real()) ? RealInterval::Undefined() : RealInterval(value.real(), value.real());
+    }
+  }
+  delete evaluation;
+  return result;
+}
+
+DualNumber Expression::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  if (approximationDependsOnSymbol(symbol, context)) {
+    return DualNumber::Undifferentiable();
+  }
+  Evaluation<double> * evaluation = privateApproximate(DoublePrecision(), context, angleUnit);
+  DualNumber result = DualNumber::Undifferentiable();
+  if (evaluation->type() == Evaluation<double>::Type::Complex) {
+    result = DualNumber::Constant(*static_cast<Complex<double> *>(evaluation));
+  }
+  delete evaluation;
+  return result;
+}
+
+bool Expression::approximationDependsOnSymbol(char symbol, Context & context) const {
+  bool isRandom = recursivelyMatches([](const Expression * e, Context & context) {
+      return e->type() == Type::Random || e->type() == Type::Randint;
+    }, context);
+  // Leaves other than the symbol (undef...) do not depend on it
+  return isRandom || (numberOfOperands() > 0 && polynomialDegree(symbol) != 0);
+}
+
 template<typename T>
 T Expression::approximateWithValueForSymbol(char symbol, T x, Context & context, AngleUnit angleUnit) const {
   VariableContext<T> variableContext = VariableContext<T>(symbol, &context);
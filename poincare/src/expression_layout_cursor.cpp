@@ -236,6 +236,7 @@ void ExpressionLayoutCursor::clearLayout() {
   ExpressionLayout * rootLayout = m_pointedExpressionLayout->editableRoot();
   assert(rootLayout->isHorizontal());
   static_cast<HorizontalLayout *>(rootLayout)->removeAndDeleteChildren();
+  rootLayout->invalidAncestorsSizesPositionsAndBaselines();
   m_pointedExpressionLayout = rootLayout;
 }
 
@@ -11,7 +11,8 @@ namespace Poincare {
 GlobalContext::GlobalContext() :
   m_pi(M_PI),
   m_e(M_E),
-  m_i(0.0, 1.0)
+  m_i(0.0, 1.0),
+  m_simplificationCache()
 {
   for (int i = 0; i < k_maxNumberOfScalarExpressions; i++) {
     m_expressions[i] = nullptr;
@@ -91,6 +92,7 @@ ExpressionLayout * GlobalContext::expressionLayoutForSymbol(const Symbol * symbo
 }
 
 void GlobalContext::setExpressionForSymbolName(const Expression * expression, const Symbol * symbol, Context & context) {
+  m_simplificationCache.invalidateSymbol(symbol);
   int index = symbolIndex(symbol);
  if (symbol->isMatrixSymbol()) {
     int indexMatrix = symbol->name() - (char)Symbol::SpecialSymbols::M0;
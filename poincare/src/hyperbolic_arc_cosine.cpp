@@ -1,6 +1,10 @@
 #include <poincare/hyperbolic_arc_cosine.h>
 #include <poincare/simplification_engine.h>
 #include <poincare/trigonometry.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
+#include <poincare/multiplication.h>
+#include <poincare/subtraction.h>
 extern "C" {
 #include <assert.h>
 }
@@ -31,6 +35,16 @@ Expression * HyperbolicArcCosine::shallowReduce(Context& context, AngleUnit angl
   return this;
 }
 
+Expression * HyperbolicArcCosine::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // acosh(u)' = u'/sqrt(u^2-1)
+  Subtraction * s = new Subtraction(new Power(operand(0), new Rational(2), true), new Rational(1), false);
+  return new Multiplication(new Power(s, new Rational(-1, 2), false), operandDerivative, false);
+}
+
 template<typename T>
 std::complex<T> HyperbolicArcCosine::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> result = std::acosh(c);
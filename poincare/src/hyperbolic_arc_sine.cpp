@@ -1,6 +1,10 @@
 #include <poincare/hyperbolic_arc_sine.h>
 #include <poincare/simplification_engine.h>
 #include <poincare/trigonometry.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
+#include <poincare/multiplication.h>
+#include <poincare/addition.h>
 extern "C" {
 #include <assert.h>
 }
@@ -31,6 +35,16 @@ Expression * HyperbolicArcSine::shallowReduce(Context& context, AngleUnit angleU
   return this;
 }
 
+Expression * HyperbolicArcSine::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // asinh(u)' = u'/sqrt(u^2+1)
+  Addition * a = new Addition(new Power(operand(0), new Rational(2), true), new Rational(1), false);
+  return new Multiplication(new Power(a, new Rational(-1, 2), false), operandDerivative, false);
+}
+
 template<typename T>
 std::complex<T> HyperbolicArcSine::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> result = std::asinh(c);
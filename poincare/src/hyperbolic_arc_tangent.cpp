@@ -1,6 +1,10 @@
 #include <poincare/hyperbolic_arc_tangent.h>
 #include <poincare/simplification_engine.h>
 #include <poincare/trigonometry.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
+#include <poincare/multiplication.h>
+#include <poincare/subtraction.h>
 extern "C" {
 #include <assert.h>
 }
@@ -31,6 +35,16 @@ Expression * HyperbolicArcTangent::shallowReduce(Context& context, AngleUnit ang
   return this;
 }
 
+Expression * HyperbolicArcTangent::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // atanh(u)' = u'/(1-u^2)
+  Subtraction * s = new Subtraction(new Rational(1), new Power(operand(0), new Rational(2), true), false);
+  return new Multiplication(new Power(s, new Rational(-1), false), operandDerivative, false);
+}
+
 template<typename T>
 std::complex<T> HyperbolicArcTangent::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> result = std::atanh(c);
@@ -5,6 +5,8 @@
 #include <poincare/opposite.h>
 #include <poincare/simplification_engine.h>
 #include <poincare/trigonometry.h>
+#include <poincare/multiplication.h>
+#include <poincare/hyperbolic_sine.h>
 extern "C" {
 #include <assert.h>
 }
@@ -35,6 +37,15 @@ Expression * HyperbolicCosine::shallowReduce(Context& context, AngleUnit angleUn
   return this;
 }
 
+Expression * HyperbolicCosine::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // cosh(u)' = sinh(u)*u'
+  return new Multiplication(new HyperbolicSine(operand(0), true), operandDerivative, false);
+}
+
 template<typename T>
 std::complex<T> HyperbolicCosine::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   return Trigonometry::RoundToMeaningfulDigits(std::cosh(c));
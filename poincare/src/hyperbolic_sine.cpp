@@ -5,6 +5,8 @@
 #include <poincare/opposite.h>
 #include <poincare/simplification_engine.h>
 #include <poincare/trigonometry.h>
+#include <poincare/multiplication.h>
+#include <poincare/hyperbolic_cosine.h>
 extern "C" {
 #include <assert.h>
 }
@@ -35,6 +37,15 @@ Expression * HyperbolicSine::shallowReduce(Context& context, AngleUnit angleUnit
   return this;
 }
 
+Expression * HyperbolicSine::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // sinh(u)' = cosh(u)*u'
+  return new Multiplication(new HyperbolicCosine(operand(0), true), operandDerivative, false);
+}
+
 template<typename T>
 std::complex<T> HyperbolicSine::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   return Trigonometry::RoundToMeaningfulDigits(std::sinh(c));
@@ -4,6 +4,9 @@
 #include <poincare/division.h>
 #include <poincare/simplification_engine.h>
 #include <poincare/trigonometry.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
+#include <poincare/multiplication.h>
 extern "C" {
 #include <assert.h>
 }
@@ -34,6 +37,16 @@ Expression * HyperbolicTangent::shallowReduce(Context& context, AngleUnit angleU
   return this;
 }
 
+Expression * HyperbolicTangent::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // tanh(u)' = u'/cosh(u)^2
+  Power * inverseSquaredCosine = new Power(new HyperbolicCosine(operand(0), true), new Rational(-2), false);
+  return new Multiplication(inverseSquaredCosine, operandDerivative, false);
+}
+
 template<typename T>
 std::complex<T> HyperbolicTangent::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   return Trigonometry::RoundToMeaningfulDigits(std::tanh(c));
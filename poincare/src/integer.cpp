@@ -35,6 +35,140 @@ static inline int8_t sign(bool negative) {
   return 1 - 2*(int8_t)negative;
 }
 
+/* The following helpers work on little-endian arrays of native_uint_t. They
+ * are the building blocks of Integer::umul. */
+
+// Add b to a in place, return the carry out of a.
+static bool add_in_place(Integer::native_uint_t * a, uint16_t aSize, const Integer::native_uint_t * b, uint16_t bSize) {
+  assert(aSize >= bSize);
+  bool carry = false;
+  for (uint16_t i = 0; i < aSize && (i < bSize || carry); i++) {
+    Integer::native_uint_t aDigit = a[i];
+    Integer::native_uint_t result = aDigit + (i < bSize ? b[i] : 0) + carry;
+    carry = (aDigit > result) || (carry && aDigit == result); // There's been an overflow
+    a[i] = result;
+  }
+  return carry;
+}
+
+// Subtract b from a in place, a has to be greater than b.
+static void subtract_in_place(Integer::native_uint_t * a, uint16_t aSize, const Integer::native_uint_t * b, uint16_t bSize) {
+  assert(aSize >= bSize);
+  bool carry = false;
+  for (uint16_t i = 0; i < aSize && (i < bSize || carry); i++) {
+    Integer::native_uint_t aDigit = a[i];
+    Integer::native_uint_t result = aDigit - (i < bSize ? b[i] : 0) - carry;
+    carry = (aDigit < result) || (carry && aDigit == result); // There's been an underflow
+    a[i] = result;
+  }
+  assert(!carry);
+}
+
+static void schoolbook_multiplication(const Integer::native_uint_t * a, uint16_t aSize, const Integer::native_uint_t * b, uint16_t bSize, Integer::native_uint_t * product) {
+  memset(product, 0, (aSize+bSize)*sizeof(Integer::native_uint_t));
+  for (uint16_t i=0; i<aSize; i++) {
+    Integer::double_native_uint_t aDigit = a[i];
+    Integer::double_native_uint_t carry = 0;
+    for (uint16_t j=0; j<bSize; j++) {
+      Integer::double_native_uint_t bDigit = b[j];
+      /* The fact that aDigit and bDigit are double_native is very important,
+       * otherwise the product might end up being computed on single_native size
+       * and then zero-padded. */
+      Integer::double_native_uint_t p = aDigit*bDigit + carry + (Integer::double_native_uint_t)(product[i+j]); // TODO: Prove it cannot overflow double_native type
+      Integer::native_uint_t * l = (Integer::native_uint_t *)&p;
+      product[i+j] = l[0];
+      carry = l[1];
+    }
+    product[i+bSize] += carry;
+  }
+}
+
+// Number of trailing zero bits of a non-null native digit
+static inline uint8_t trailing_zeros(Integer::native_uint_t v) {
+  assert(v != 0);
+  return __builtin_ctz(v);
+}
+
+static Integer::native_uint_t binary_gcd(Integer::native_uint_t u, Integer::native_uint_t v) {
+  // Stein's algorithm
+  if (u == 0 || v == 0) {
+    return u | v;
+  }
+  uint8_t shift = trailing_zeros(u | v);
+  u >>= trailing_zeros(u);
+  do {
+    v >>= trailing_zeros(v);
+    if (u > v) {
+      Integer::native_uint_t t = u;
+      u = v;
+      v = t;
+    }
+    v -= u;
+  } while (v != 0);
+  return u << shift;
+}
+
+static int trailing_zeros(const Integer::native_uint_t * a, uint16_t aSize) {
+  uint16_t i = 0;
+  while (a[i] == 0) {
+    i++;
+    assert(i < aSize);
+  }
+  return 8*sizeof(Integer::native_uint_t)*i + trailing_zeros(a[i]);
+}
+
+static inline uint16_t trimmed_size(const Integer::native_uint_t * a, uint16_t aSize) {
+  while (aSize > 1 && a[aSize-1] == 0) {
+    aSize--;
+  }
+  return aSize;
+}
+
+// Shift a to the right in place, return its new size
+static uint16_t shift_right_in_place(Integer::native_uint_t * a, uint16_t aSize, int shift) {
+  constexpr int nativeUnsignedIntegerBitCount = 8*sizeof(Integer::native_uint_t);
+  uint16_t digitShift = shift/nativeUnsignedIntegerBitCount;
+  uint8_t bitShift = shift%nativeUnsignedIntegerBitCount;
+  assert(digitShift < aSize);
+  for (uint16_t i = 0; i+digitShift < aSize; i++) {
+    Integer::native_uint_t digit = a[i+digitShift] >> bitShift;
+    if (bitShift != 0 && i+digitShift+1 < aSize) {
+      digit |= a[i+digitShift+1] << (nativeUnsignedIntegerBitCount-bitShift);
+    }
+    a[i] = digit;
+  }
+  return trimmed_size(a, aSize-digitShift);
+}
+
+// Shift a to the left in place, a has to be able to hold the result
+static uint16_t shift_left_in_place(Integer::native_uint_t * a, uint16_t aSize, int shift, uint16_t capacity) {
+  constexpr int nativeUnsignedIntegerBitCount = 8*sizeof(Integer::native_uint_t);
+  uint16_t digitShift = shift/nativeUnsignedIntegerBitCount;
+  uint8_t bitShift = shift%nativeUnsignedIntegerBitCount;
+  uint16_t size = aSize+digitShift+1 < capacity ? aSize+digitShift+1 : capacity;
+  for (int i = size-1; i >= 0; i--) {
+    int j = i-digitShift;
+    Integer::native_uint_t digit = j >= 0 && j < aSize ? a[j] << bitShift : 0;
+    if (bitShift != 0 && j >= 1 && j-1 < aSize) {
+      digit |= a[j-1] >> (nativeUnsignedIntegerBitCount-bitShift);
+    }
+    a[i] = digit;
+  }
+  return trimmed_size(a, size);
+}
+
+static int8_t compare(const Integer::native_uint_t * a, uint16_t aSize, const Integer::native_uint_t * b, uint16_t bSize) {
+  if (aSize != bSize) {
+    return aSize < bSize ? -1 : 1;
+  }
+  for (int i = aSize-1; i >= 0; i--) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
 // Constructors
 
 static_assert(sizeof(Integer::double_native_int_t) == 2*sizeof(Integer::native_int_t), "double_native_int_t type has not the right size compared to native_int_t");
@@ -69,11 +203,12 @@ Integer::Integer(const char * digits, bool negative) :
   Integer result = Integer(0);
 
   if (digits != nullptr) {
-    Integer base = Integer(10);
-    while (*digits >= '0' && *digits <= '9') {
-      result = Multiplication(result, base);
-      result = Addition(result, Integer(*digits-'0'));
-      digits++;
+    int length = 0;
+    while (digits[length] >= '0' && digits[length] <= '9') {
+      length++;
+    }
+    if (length > 0) {
+      result = parseDigits(digits, length);
     }
   }
 
@@ -229,6 +364,24 @@ bool Integer::isLowerThan(const Integer & other) const {
   return (NaturalOrder(*this, other) < 0);
 }
 
+uint32_t Integer::hash() const {
+  // FNV-1a on the sign and the significant digits
+  uint32_t hash = 2166136261u ^ (m_negative ? 1 : 0);
+  hash *= 16777619u;
+  int numberOfDigits = m_numberOfDigits;
+  while (numberOfDigits > 1 && digit(numberOfDigits-1) == 0) {
+    numberOfDigits--;
+  }
+  for (int i = 0; i < numberOfDigits; i++) {
+    native_uint_t d = digit(i);
+    for (int j = 0; j < (int)sizeof(native_uint_t); j++) {
+      hash ^= (d >> (8*j)) & 0xFF;
+      hash *= 16777619u;
+    }
+  }
+  return hash;
+}
+
 // Arithmetic
 
 Integer Integer::Addition(const Integer & a, const Integer & b) {
@@ -240,27 +393,9 @@ Integer Integer::Subtraction(const Integer & a, const Integer & b) {
 }
 
 Integer Integer::Multiplication(const Integer & a, const Integer & b) {
-  assert(sizeof(double_native_uint_t) == 2*sizeof(native_uint_t));
   uint16_t productSize = a.m_numberOfDigits + b.m_numberOfDigits;
   native_uint_t * digits = new native_uint_t [productSize];
-  memset(digits, 0, productSize*sizeof(native_uint_t));
-
-  double_native_uint_t carry = 0;
-  for (uint16_t i=0; i<a.m_numberOfDigits; i++) {
-    double_native_uint_t aDigit = a.digit(i);
-    carry = 0;
-    for (uint16_t j=0; j<b.m_numberOfDigits; j++) {
-      double_native_uint_t bDigit = b.digit(j);
-      /* The fact that aDigit and bDigit are double_native is very important,
-       * otherwise the product might end up being computed on single_native size
-       * and then zero-padded. */
-      double_native_uint_t p = aDigit*bDigit + carry + (double_native_uint_t)(digits[i+j]); // TODO: Prove it cannot overflow double_native type
-      native_uint_t * l = (native_uint_t *)&p;
-      digits[i+j] = l[0];
-      carry = l[1];
-    }
-    digits[i+b.m_numberOfDigits] += carry;
-  }
+  umul(a.digits(), a.m_numberOfDigits, b.digits(), b.m_numberOfDigits, digits);
 
   while (digits[productSize-1] == 0 && productSize>1) {
     productSize--;
@@ -313,13 +448,25 @@ IntegerDivision Integer::Division(const Integer & numerator, const Integer & den
 }
 
 Integer Integer::Power(const Integer & i, const Integer & j) {
-  // TODO: optimize with dichotomia
   assert(!j.isNegative());
-  Integer index = j;
+  /* Exponentiation by squaring: we scan the bits of j from the least
+   * significant one. At the k-th bit, base = i^(2^k). */
   Integer result = Integer(1);
-  while (!index.isEqualTo(Integer(0))) {
-    result = Multiplication(result, i);
-    index = Subtraction(index, Integer(1));
+  Integer base = i;
+  for (uint16_t d = 0; d < j.m_numberOfDigits; d++) {
+    native_uint_t exponentDigit = j.digit(d);
+    bool isLastDigit = d == j.m_numberOfDigits - 1;
+    for (uint8_t k = 0; k < 8*sizeof(native_uint_t); k++) {
+      if (exponentDigit & 1) {
+        result = Multiplication(result, base);
+      }
+      exponentDigit >>= 1;
+      if (isLastDigit && exponentDigit == 0) {
+        // Avoid computing a useless square
+        break;
+      }
+      base = Multiplication(base, base);
+    }
   }
   return result;
 }
@@ -490,6 +637,266 @@ IntegerDivision Integer::udiv(const Integer & numerator, const Integer & denomin
   return div;
 }
 
+void Integer::umul(const native_uint_t * a, uint16_t aSize, const native_uint_t * b, uint16_t bSize, native_uint_t * product) {
+  /* product has to be able to hold aSize+bSize digits. All of them are set,
+   * even if the most significant ones end up being zero. */
+  if (aSize < bSize) {
+    umul(b, bSize, a, aSize, product);
+    return;
+  }
+  if (bSize < k_karatsubaThreshold) {
+    schoolbook_multiplication(a, aSize, b, bSize, product);
+    return;
+  }
+  if (2*bSize <= aSize) {
+    /* The operands are too unbalanced to be split at the same index: we slice
+     * a into chunks of bSize digits and accumulate the partial products. */
+    memset(product, 0, (aSize+bSize)*sizeof(native_uint_t));
+    native_uint_t * partialProduct = new native_uint_t [2*bSize];
+    for (uint16_t i = 0; i < aSize; i += bSize) {
+      uint16_t chunkSize = aSize-i < bSize ? aSize-i : bSize;
+      umul(a+i, chunkSize, b, bSize, partialProduct);
+      add_in_place(product+i, aSize+bSize-i, partialProduct, chunkSize+bSize);
+    }
+    delete[] partialProduct;
+    return;
+  }
+  /* Karatsuba's algorithm (Modern Computer Arithmetic, Algorithm 1.2)
+   * With a = a1*B^m+a0 and b = b1*B^m+b0, we have
+   * a*b = a1*b1*B^2m + ((a0+a1)*(b0+b1)-a0*b0-a1*b1)*B^m + a0*b0
+   * which only costs three multiplications of half size numbers. */
+  uint16_t m = aSize/2;
+  assert(bSize > m);
+  uint16_t a1Size = aSize-m;
+  uint16_t b1Size = bSize-m;
+  umul(a, m, b, m, product);
+  umul(a+m, a1Size, b+m, b1Size, product+2*m);
+
+  // a1Size >= m so a0+a1 holds in a1Size+1 digits
+  uint16_t aSumSize = a1Size+1;
+  uint16_t bSumSize = max(m, b1Size)+1;
+  uint16_t middleSize = aSumSize+bSumSize;
+  native_uint_t * aSum = new native_uint_t [aSumSize+bSumSize+middleSize];
+  native_uint_t * bSum = aSum+aSumSize;
+  native_uint_t * middle = bSum+bSumSize;
+  memcpy(aSum, a+m, a1Size*sizeof(native_uint_t));
+  aSum[a1Size] = 0;
+  add_in_place(aSum, aSumSize, a, m);
+  if (b1Size >= m) {
+    memcpy(bSum, b+m, b1Size*sizeof(native_uint_t));
+    bSum[b1Size] = 0;
+    add_in_place(bSum, bSumSize, b, m);
+  } else {
+    memcpy(bSum, b, m*sizeof(native_uint_t));
+    bSum[m] = 0;
+    add_in_place(bSum, bSumSize, b+m, b1Size);
+  }
+  umul(aSum, aSumSize, bSum, bSumSize, middle);
+  subtract_in_place(middle, middleSize, product, 2*m);
+  subtract_in_place(middle, middleSize, product+2*m, a1Size+b1Size);
+  while (middleSize > 0 && middle[middleSize-1] == 0) {
+    middleSize--;
+  }
+  add_in_place(product+m, aSize+bSize-m, middle, middleSize);
+  delete[] aSum;
+}
+
+Integer Integer::parseDigits(const char * digits, int length) {
+  assert(length > 0);
+  int numberOfChunks = (length+k_numberOfDecimalDigitsInNativeDigit-1)/k_numberOfDecimalDigitsInNativeDigit;
+  native_uint_t * result = new native_uint_t [numberOfChunks];
+  uint16_t size = 1;
+  result[0] = 0;
+  // The first chunk holds the leading digits that do not fill a whole chunk
+  int chunkLength = length - (numberOfChunks-1)*k_numberOfDecimalDigitsInNativeDigit;
+  while (length > 0) {
+    native_uint_t chunk = 0;
+    native_uint_t chunkBase = 1;
+    for (int i = 0; i < chunkLength; i++) {
+      chunk = 10*chunk + (*digits++ - '0');
+      chunkBase *= 10;
+    }
+    length -= chunkLength;
+    chunkLength = k_numberOfDecimalDigitsInNativeDigit;
+    // result = result*chunkBase + chunk
+    double_native_uint_t carry = chunk;
+    for (uint16_t i = 0; i < size; i++) {
+      double_native_uint_t p = (double_native_uint_t)result[i]*chunkBase + carry;
+      native_uint_t * l = (native_uint_t *)&p;
+      result[i] = l[0];
+      carry = l[1];
+    }
+    if (carry != 0) {
+      assert(size < numberOfChunks);
+      result[size++] = carry;
+    }
+  }
+  return Integer(result, size, false);
+}
+
+int Integer::writeDigits(const Integer & i, char * buffer, int bufferSize) {
+  /* Write the decimal digits of i, which is positive. Return the number of
+   * chars written or -1 if they do not fit in the buffer (keeping room for the
+   * null char). */
+  assert(!i.isNegative());
+  /* Repeatedly divide by 10^4, which only takes one pass over the half native
+   * digits, and store the remainders as chunks. */
+  uint16_t size = i.numberOfHalfDigits();
+  half_native_uint_t * quotient = new half_native_uint_t [size];
+  for (uint16_t j = 0; j < size; j++) {
+    quotient[j] = i.halfDigit(j);
+  }
+  // A half native digit holds at most two chunks
+  half_native_uint_t * chunks = new half_native_uint_t [2*size];
+  int numberOfChunks = 0;
+  do {
+    native_uint_t remainder = 0;
+    for (int j = size-1; j >= 0; j--) {
+      native_uint_t dividend = (remainder << (8*sizeof(half_native_uint_t))) + quotient[j];
+      quotient[j] = dividend / k_halfNativeDigitDecimalBase;
+      remainder = dividend % k_halfNativeDigitDecimalBase;
+    }
+    chunks[numberOfChunks++] = remainder;
+    while (size > 1 && quotient[size-1] == 0) {
+      size--;
+    }
+  } while (size > 1 || quotient[0] != 0);
+  delete[] quotient;
+
+  // Count the digits of the most significant chunk
+  int numberOfDigits = 1;
+  for (half_native_uint_t c = chunks[numberOfChunks-1]; c >= 10; c /= 10) {
+    numberOfDigits++;
+  }
+  numberOfDigits += (numberOfChunks-1)*k_numberOfDecimalDigitsInHalfNativeDigit;
+  if (numberOfDigits >= bufferSize) {
+    delete[] chunks;
+    return -1;
+  }
+  // Fill the buffer from its end, chunk by chunk
+  int position = numberOfDigits;
+  for (int j = 0; j < numberOfChunks; j++) {
+    half_native_uint_t c = chunks[j];
+    int chunkLength = j < numberOfChunks-1 ? k_numberOfDecimalDigitsInHalfNativeDigit : numberOfDigits-(numberOfChunks-1)*k_numberOfDecimalDigitsInHalfNativeDigit;
+    for (int k = 0; k < chunkLength; k++) {
+      buffer[--position] = char_from_digit(c%10);
+      c /= 10;
+    }
+  }
+  assert(position == 0);
+  delete[] chunks;
+  return numberOfDigits;
+}
+
+Integer Integer::ugcd(const Integer & a, const Integer & b) {
+  Integer u = a;
+  Integer v = b;
+  u.setNegative(false);
+  v.setNegative(false);
+  if (u.m_numberOfDigits == 1 && v.m_numberOfDigits == 1) {
+    return Integer((double_native_int_t)binary_gcd(u.digit(0), v.digit(0)));
+  }
+  if (ucmp(u, v) < 0) {
+    Integer t = std::move(u);
+    u = std::move(v);
+    v = std::move(t);
+  }
+  /* Lehmer's algorithm (Modern Computer Arithmetic, Richard P. Brent and Paul
+   * Zimmermann, 1.6.1 or The Art of Computer Programming, Donald E. Knuth,
+   * Algorithm 4.5.2.L). The Euclidean steps on the leading bits x and y of u
+   * and v give the right quotients as long as the quotients of (x+A)/(y+C)
+   * and (x+B)/(y+D) agree, where (A, B, C, D) is the cumulated cofactor
+   * matrix. This matrix is then applied at once to u and v. */
+  while (v.m_numberOfDigits >= k_lehmerThreshold) {
+    int shift = 8*sizeof(native_uint_t)*(u.m_numberOfDigits-1) + log2(u.digit(u.m_numberOfDigits-1)) - k_lehmerNumberOfBits;
+    native_int_t x = leadingBits(u, shift);
+    native_int_t y = leadingBits(v, shift);
+    native_int_t A = 1, B = 0, C = 0, D = 1;
+    while (y + C != 0 && y + D != 0) {
+      native_int_t q = (x + A)/(y + C);
+      if (q != (x + B)/(y + D)) {
+        break;
+      }
+      native_int_t t = A - q*C;
+      A = C;
+      C = t;
+      t = B - q*D;
+      B = D;
+      D = t;
+      t = x - q*y;
+      x = y;
+      y = t;
+    }
+    if (B == 0) {
+      /* Not even one quotient could be found with the leading bits: they are
+       * too different. Perform a full Euclidean step. */
+      Integer r = udiv(u, v).remainder;
+      u = std::move(v);
+      v = std::move(r);
+    } else {
+      Integer newU = Addition(Multiplication(Integer(A), u), Multiplication(Integer(B), v));
+      Integer newV = Addition(Multiplication(Integer(C), u), Multiplication(Integer(D), v));
+      u = std::move(newU);
+      v = std::move(newV);
+    }
+  }
+  if (v.isZero()) {
+    return u;
+  }
+  if (u.m_numberOfDigits >= k_lehmerThreshold) {
+    Integer r = udiv(u, v).remainder;
+    u = std::move(v);
+    v = std::move(r);
+    if (v.isZero()) {
+      return u;
+    }
+  }
+  // Stein's algorithm on the remaining digits
+  uint16_t capacity = u.m_numberOfDigits;
+  native_uint_t * x = new native_uint_t [capacity];
+  native_uint_t * y = new native_uint_t [capacity];
+  uint16_t xSize = u.m_numberOfDigits;
+  uint16_t ySize = v.m_numberOfDigits;
+  memcpy(x, u.digits(), xSize*sizeof(native_uint_t));
+  memcpy(y, v.digits(), ySize*sizeof(native_uint_t));
+  int xShift = trailing_zeros(x, xSize);
+  int yShift = trailing_zeros(y, ySize);
+  xSize = shift_right_in_place(x, xSize, xShift);
+  do {
+    ySize = shift_right_in_place(y, ySize, trailing_zeros(y, ySize));
+    if (compare(x, xSize, y, ySize) > 0) {
+      native_uint_t * t = x;
+      x = y;
+      y = t;
+      uint16_t tSize = xSize;
+      xSize = ySize;
+      ySize = tSize;
+    }
+    subtract_in_place(y, ySize, x, xSize);
+    ySize = trimmed_size(y, ySize);
+  } while (ySize > 1 || y[0] != 0);
+  delete[] y;
+  xSize = shift_left_in_place(x, xSize, xShift < yShift ? xShift : yShift, capacity);
+  return Integer(x, xSize, false);
+}
+
+Integer::native_int_t Integer::leadingBits(const Integer & i, int shift) {
+  // Bits of i from shift to shift+k_lehmerNumberOfBits
+  assert(shift >= 0);
+  constexpr int nativeUnsignedIntegerBitCount = 8*sizeof(native_uint_t);
+  int digitIndex = shift/nativeUnsignedIntegerBitCount;
+  if (digitIndex >= i.m_numberOfDigits) {
+    return 0;
+  }
+  double_native_uint_t window = i.digit(digitIndex);
+  if (digitIndex+1 < i.m_numberOfDigits) {
+    window |= (double_native_uint_t)i.digit(digitIndex+1) << nativeUnsignedIntegerBitCount;
+  }
+  window >>= shift%nativeUnsignedIntegerBitCount;
+  assert(window < ((double_native_uint_t)1 << k_lehmerNumberOfBits));
+  return window;
+}
+
 template<typename T>
 T Integer::approximate() const {
   if (isZero()) {
@@ -562,43 +969,21 @@ int Integer::writeTextInBuffer(char * buffer, int bufferSize) const {
     return -1;
   }
   buffer[bufferSize-1] = 0;
-  /* If the integer is too long, this method may be too slow.
-   * Experimentally, we can display at most integer whose number of digits is
-   * around 25. */
-  if (m_numberOfDigits > 25) {
-    return strlcpy(buffer, "undef", bufferSize);
-  }
-
-  Integer base = Integer(10);
-  Integer abs = *this;
-  abs.setNegative(false);
-  IntegerDivision d = udiv(abs, base);
-  int size = 0;
   if (bufferSize == 1) {
     return 0;
   }
-  if (isEqualTo(Integer(0))) {
-    buffer[size++] = '0';
-  } else if (isNegative()) {
+  int size = 0;
+  if (isNegative()) {
     buffer[size++] = '-';
   }
-  while (!(d.remainder.isEqualTo(Integer(0)) &&
-        d.quotient.isEqualTo(Integer(0)))) {
-    char c = char_from_digit(d.remainder.digit(0));
-    if (size >= bufferSize-1) {
-      return strlcpy(buffer, "undef", bufferSize);
-    }
-    buffer[size++] = c;
-    d = Division(d.quotient, base);
+  Integer abs = *this;
+  abs.setNegative(false);
+  int numberOfDigits = writeDigits(abs, buffer+size, bufferSize-size);
+  if (numberOfDigits < 0) {
+    return strlcpy(buffer, "undef", bufferSize);
   }
+  size += numberOfDigits;
   buffer[size] = 0;
-
-  // Flip the string
-  for (int i=m_negative, j=size-1 ; i < j ; i++, j--) {
-    char c = buffer[i];
-    buffer[i] = buffer[j];
-    buffer[j] = c;
-  }
   return size;
 }
 
@@ -58,10 +58,12 @@ Complex<T> * Integral::templatedApproximate(Context & context, AngleUnit angleUn
   if (std::isnan(a) || std::isnan(b)) {
     return new Complex<T>(Complex<T>::Undefined());
   }
+  // The integrand is compiled once for all the quadrature abscissae
+  ApproximationProgram<T> function(operand(0), 'x', context, angleUnit);
 #ifdef LAGRANGE_METHOD
-  T result = lagrangeGaussQuadrature<T>(a, b, context, angleUnit);
+  T result = lagrangeGaussQuadrature<T>(a, b, function, context);
 #else
-  T result = adaptiveQuadrature<T>(a, b, 0.1, k_maxNumberOfIterations, context, angleUnit);
+  T result = adaptiveQuadrature<T>(a, b, 0.1, k_maxNumberOfIterations, function, context);
 #endif
   return new Complex<T>(result);
 }
@@ -74,15 +76,10 @@ ExpressionLayout * Integral::createLayout(PrintFloat::Mode floatDisplayMode, int
       false);
 }
 
-template<typename T>
-T Integral::functionValueAtAbscissa(T x, Context & context, AngleUnit angleUnit) const {
-  return operand(0)->approximateWithValueForSymbol('x', x, context, angleUnit);
-}
-
 #ifdef LAGRANGE_METHOD
 
 template<typename T>
-T Integral::lagrangeGaussQuadrature(T a, T b, Context & context, AngleUnit angleUnit) const {
+T Integral::lagrangeGaussQuadrature(T a, T b, const ApproximationProgram<T> & function, Context & context) const {
   /* We here use Gauss-Legendre quadrature with n = 5
    * Gauss-Legendre abscissae and weights can be found in
    * C/C++ library source code. */
@@ -96,11 +93,11 @@ T Integral::lagrangeGaussQuadrature(T a, T b, Context & context, AngleUnit angle
   T result = 0;
   for (int j = 0; j < 10; j++) {
     T dx = xr * x[j];
-    T evaluationAfterX = functionValueAtAbscissa(xm+dx, context, angleUnit);
+    T evaluationAfterX = function.approximateWithValueForSymbol(xm+dx, context);
     if (std::isnan(evaluationAfterX)) {
       return NAN;
     }
-    T evaluationBeforeX = functionValueAtAbscissa(xm-dx, context, angleUnit);
+    T evaluationBeforeX = function.approximateWithValueForSymbol(xm-dx, context);
     if (std::isnan(evaluationBeforeX)) {
       return NAN;
     }
@@ -112,26 +109,37 @@ T Integral::lagrangeGaussQuadrature(T a, T b, Context & context, AngleUnit angle
 
 #else
 
+/* We here use Kronrod-Legendre quadrature with n = 21
+ * The abscissa and weights are taken from QUADPACK library. */
+static const double sKronrodAbscissae[11] = {0.995657163025808080735527280689003, 0.973906528517171720077964012084452,
+  0.930157491355708226001207180059508, 0.865063366688984510732096688423493, 0.780817726586416897063717578345042,
+  0.679409568299024406234327365114874, 0.562757134668604683339000099272694, 0.433395394129247190799265943165784,
+  0.294392862701460198131126603103866, 0.148874338981631210884826001129720, 0.000000000000000000000000000000000};
+
+template<typename T>
+void Integral::kronrodAbscissae(T a, T b, T * abscissae) const {
+  // The center comes first, then the symmetric abscissae by pairs
+  T centr = 0.5*(a+b);
+  T hlgth = 0.5*(b-a);
+  abscissae[0] = centr;
+  for (int j = 0; j < 10; j++) {
+    T absc = hlgth*(T)sKronrodAbscissae[j];
+    abscissae[2*j+1] = centr-absc;
+    abscissae[2*j+2] = centr+absc;
+  }
+}
+
 template<typename T>
-Integral::DetailedResult<T> Integral::kronrodGaussQuadrature(T a, T b, Context & context, AngleUnit angleUnit) const {
+Integral::DetailedResult<T> Integral::kronrodGaussQuadrature(T a, T b, const T * evaluations) const {
   static T epsilon = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
   static T max = sizeof(T) == sizeof(double) ? DBL_MAX : FLT_MAX;
-  /* We here use Kronrod-Legendre quadrature with n = 21
-   * The abscissa and weights are taken from QUADPACK library. */
   const static T wg[5]= {0.066671344308688137593568809893332, 0.149451349150580593145776339657697,
     0.219086362515982043995534934228163, 0.269266719309996355091226921569469, 0.295524224714752870173892994651338};
-  const static T xgk[11]= {0.995657163025808080735527280689003, 0.973906528517171720077964012084452,
-    0.930157491355708226001207180059508, 0.865063366688984510732096688423493, 0.780817726586416897063717578345042,
-    0.679409568299024406234327365114874, 0.562757134668604683339000099272694, 0.433395394129247190799265943165784,
-    0.294392862701460198131126603103866, 0.148874338981631210884826001129720, 0.000000000000000000000000000000000};
   const static T wgk[11]= {0.011694638867371874278064396062192, 0.032558162307964727478818972459390,
     0.054755896574351996031381300244580, 0.075039674810919952767043140916190, 0.093125454583697605535065465083366,
     0.109387158802297641899210590325805, 0.123491976262065851077958109831074, 0.134709217311473325928054001771707,
     0.142775938577060080797094273138717, 0.147739104901338491374841515972068, 0.149445554002916905664936468389821};
-  T fv1[10];
-  T fv2[10];
 
-  T centr = 0.5*(a+b);
   T hlgth = 0.5*(b-a);
   T dhlgth = std::fabs(hlgth);
 
@@ -139,25 +147,19 @@ Integral::DetailedResult<T> Integral::kronrodGaussQuadrature(T a, T b, Context &
   errorResult.integral = NAN;
   errorResult.absoluteError = 0;
 
-  T resg = 0;
-  T fc = functionValueAtAbscissa(centr, context, angleUnit);
-  if (std::isnan(fc)) {
-    return errorResult;
+  for (int j = 0; j < k_numberOfKronrodAbscissae; j++) {
+    if (std::isnan(evaluations[j])) {
+      return errorResult;
+    }
   }
+
+  T resg = 0;
+  T fc = evaluations[0];
   T resk = wgk[10]*fc;
   T resabs = std::fabs(resk);
   for (int j = 0; j < 10; j++) {
-    T absc = hlgth*xgk[j];
-    T fval1 = functionValueAtAbscissa(centr-absc, context, angleUnit);
-    if (std::isnan(fval1)) {
-      return errorResult;
-    }
-    T fval2 = functionValueAtAbscissa(centr+absc, context, angleUnit);
-    if (std::isnan(fval2)) {
-      return errorResult;
-    }
-    fv1[j] = fval1;
-    fv2[j] = fval2;
+    T fval1 = evaluations[2*j+1];
+    T fval2 = evaluations[2*j+2];
     T fsum = fval1+fval2;
     if (j%2 == 1) {
       resg += wg[j/2]*fsum;
@@ -169,7 +171,7 @@ Integral::DetailedResult<T> Integral::kronrodGaussQuadrature(T a, T b, Context &
   T reskh = resk*0.5;
   T resasc = wgk[10]*std::fabs(fc-reskh);
   for (int j = 0; j < 10; j++) {
-    resasc += wgk[j]*(std::fabs(fv1[j]-reskh)+std::fabs(fv2[j]-reskh));
+    resasc += wgk[j]*(std::fabs(evaluations[2*j+1]-reskh)+std::fabs(evaluations[2*j+2]-reskh));
   }
   T integral = resk*hlgth;
   resabs = resabs*dhlgth;
@@ -187,22 +189,119 @@ Integral::DetailedResult<T> Integral::kronrodGaussQuadrature(T a, T b, Context &
   return result;
 }
 
+/* The subintervals are kept in a max-heap ranked by absolute error */
+
+template<typename T>
+static inline bool hasLowerError(const T & s1, const T & s2) {
+  return s1.quadrature.absoluteError < s2.quadrature.absoluteError;
+}
+
 template<typename T>
-T Integral::adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, Context & context, AngleUnit angleUnit) const {
-  if (shouldStopProcessing()) {
-    return NAN;
+static void siftDown(T * heap, int numberOfElements, int index) {
+  while (2*index+1 < numberOfElements) {
+    int child = 2*index+1;
+    if (child+1 < numberOfElements && hasLowerError(heap[child], heap[child+1])) {
+      child++;
+    }
+    if (!hasLowerError(heap[index], heap[child])) {
+      return;
+    }
+    T temp = heap[index];
+    heap[index] = heap[child];
+    heap[child] = temp;
+    index = child;
   }
-  DetailedResult<T> quadKG = kronrodGaussQuadrature(a, b, context, angleUnit);
-  T result = quadKG.integral;
-  if (quadKG.absoluteError <= eps) {
-    return result;
-  } else if (--numberOfIterations > 0) {
-    T m = (a+b)/2;
-    return adaptiveQuadrature<T>(a, m, eps/2, numberOfIterations, context, angleUnit) + adaptiveQuadrature<T>(m, b, eps/2, numberOfIterations, context, angleUnit);
-  } else {
-    return NAN;
+}
+
+template<typename T>
+static void siftUp(T * heap, int index) {
+  while (index > 0 && hasLowerError(heap[(index-1)/2], heap[index])) {
+    T temp = heap[index];
+    heap[index] = heap[(index-1)/2];
+    heap[(index-1)/2] = temp;
+    index = (index-1)/2;
   }
 }
+
+template<typename T>
+T Integral::adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, const ApproximationProgram<T> & function, Context & context) const {
+  /* Global adaptive strategy of QUADPACK QAG: the subinterval with the largest
+   * error is bisected until the total error is lower than eps. The two halves
+   * are evaluated as a single batch of abscissae. As with a plain recursion,
+   * the integral is undefined when a subinterval needs more than
+   * numberOfIterations bisections.
+   * When the heap is full, the subinterval with the lowest error is retired to
+   * make room for the new halves: it is not bisected any more, and its
+   * contributions are kept in the retired sums. The number of bisections is
+   * thus only bounded by numberOfIterations, as with a plain recursion. */
+  T abscissae[2*k_numberOfKronrodAbscissae];
+  T evaluations[2*k_numberOfKronrodAbscissae];
+  kronrodAbscissae(a, b, abscissae);
+  function.approximateWithValuesForSymbol(abscissae, evaluations, k_numberOfKronrodAbscissae, context);
+  DetailedResult<T> quadrature = kronrodGaussQuadrature(a, b, evaluations);
+  if (std::isnan(quadrature.integral) || quadrature.absoluteError <= eps) {
+    return quadrature.integral;
+  }
+  Subinterval<T> heap[k_maxNumberOfSubintervals];
+  heap[0] = {a, b, quadrature, 1};
+  int numberOfSubintervals = 1;
+  T retiredIntegral = 0;
+  T retiredError = 0;
+  T result = NAN;
+  while (true) {
+    if (shouldStopProcessing()) {
+      break;
+    }
+    Subinterval<T> worst = heap[0];
+    if (worst.depth >= numberOfIterations) {
+      break;
+    }
+    if (numberOfSubintervals == k_maxNumberOfSubintervals) {
+      // The subinterval with the lowest error is a leaf of the heap
+      int best = numberOfSubintervals/2;
+      for (int i = best+1; i < numberOfSubintervals; i++) {
+        if (hasLowerError(heap[i], heap[best])) {
+          best = i;
+        }
+      }
+      retiredIntegral += heap[best].quadrature.integral;
+      retiredError += heap[best].quadrature.absoluteError;
+      numberOfSubintervals--;
+      if (best < numberOfSubintervals) {
+        heap[best] = heap[numberOfSubintervals];
+        siftUp(heap, best);
+      }
+    }
+    T m = (worst.a+worst.b)/2;
+    kronrodAbscissae(worst.a, m, abscissae);
+    kronrodAbscissae(m, worst.b, abscissae+k_numberOfKronrodAbscissae);
+    function.approximateWithValuesForSymbol(abscissae, evaluations, 2*k_numberOfKronrodAbscissae, context);
+    Subinterval<T> left = {worst.a, m, kronrodGaussQuadrature(worst.a, m, evaluations), worst.depth+1};
+    Subinterval<T> right = {m, worst.b, kronrodGaussQuadrature(m, worst.b, evaluations+k_numberOfKronrodAbscissae), worst.depth+1};
+    if (std::isnan(left.quadrature.integral) || std::isnan(right.quadrature.integral)) {
+      break;
+    }
+    // The left half replaces the bisected subinterval at the top of the heap
+    heap[0] = left;
+    siftDown(heap, numberOfSubintervals, 0);
+    heap[numberOfSubintervals] = right;
+    siftUp(heap, numberOfSubintervals);
+    numberOfSubintervals++;
+    /* The sums are computed again rather than updated to avoid accumulating
+     * rounding errors. */
+    T integral = retiredIntegral;
+    T error = retiredError;
+    for (int i = 0; i < numberOfSubintervals; i++) {
+      integral += heap[i].quadrature.integral;
+      error += heap[i].quadrature.absoluteError;
+    }
+    if (error <= eps) {
+      result = integral;
+      break;
+    }
+  }
+  return result;
+}
 #endif
 
 }
@@ -16,9 +16,9 @@ BracketLayout::BracketLayout() :
 {
 }
 
-void BracketLayout::invalidAllSizesPositionsAndBaselines() {
+void BracketLayout::invalidSizePositionAndBaseline() {
   m_operandHeightComputed = false;
-  ExpressionLayout::invalidAllSizesPositionsAndBaselines();
+  ExpressionLayout::invalidSizePositionAndBaseline();
 }
 
 ExpressionLayoutCursor BracketLayout::cursorLeftOf(ExpressionLayoutCursor cursor, bool * shouldRecomputeLayout) {
@@ -8,10 +8,10 @@ namespace Poincare {
 class BracketLayout : public StaticLayoutHierarchy<0> {
 public:
   BracketLayout();
-  void invalidAllSizesPositionsAndBaselines() override;
   ExpressionLayoutCursor cursorLeftOf(ExpressionLayoutCursor cursor, bool * shouldRecomputeLayout) override;
   ExpressionLayoutCursor cursorRightOf(ExpressionLayoutCursor cursor, bool * shouldRecomputeLayout) override;
 protected:
+  void invalidSizePositionAndBaseline() override;
   void computeBaseline() override;
   KDCoordinate operandHeight();
   void computeOperandHeight();
@@ -86,6 +86,7 @@ void DynamicLayoutHierarchy::addChildrenAtIndex(const ExpressionLayout * const *
   }
   m_children = newOperands;
   m_numberOfChildren = currentIndex;
+  invalidAncestorsSizesPositionsAndBaselines();
 }
 
 bool DynamicLayoutHierarchy::addChildAtIndex(ExpressionLayout * child, int index) {
@@ -103,6 +104,7 @@ bool DynamicLayoutHierarchy::addChildAtIndex(ExpressionLayout * child, int index
   delete[] m_children;
   m_children = newChildren;
   m_numberOfChildren += 1;
+  invalidAncestorsSizesPositionsAndBaselines();
   return true;
 }
 
@@ -117,6 +119,7 @@ void DynamicLayoutHierarchy::removeChildAtIndex(int index, bool deleteAfterRemov
   for (int j=index; j<m_numberOfChildren; j++) {
     m_children[j] = m_children[j+1];
   }
+  invalidAncestorsSizesPositionsAndBaselines();
 }
 
 void DynamicLayoutHierarchy::removePointedChildAtIndexAndMoveCursor(int index, bool deleteAfterRemoval, ExpressionLayoutCursor * cursor) {
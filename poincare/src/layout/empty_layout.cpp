@@ -20,6 +20,13 @@ ExpressionLayout * EmptyLayout::clone() const {
   return layout;
 }
 
+void EmptyLayout::setVisible(bool visible) {
+  if (m_isVisible != visible) {
+    m_isVisible = visible;
+    invalidAncestorsSizesPositionsAndBaselines();
+  }
+}
+
 void EmptyLayout::deleteBeforeCursor(ExpressionLayoutCursor * cursor) {
   cursor->setPosition(ExpressionLayoutCursor::Position::Left);
   if (m_parent) {
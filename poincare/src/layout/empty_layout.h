@@ -20,7 +20,7 @@ public:
   Color color() const { return m_color; }
   void setColor(Color color) { m_color = color; }
   bool isVisible() const { return m_isVisible; }
-  void setVisible(bool visible) { m_isVisible = visible; }
+  void setVisible(bool visible);
 
   // User input
   void deleteBeforeCursor(ExpressionLayoutCursor * cursor) override;
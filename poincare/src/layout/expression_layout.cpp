@@ -21,26 +21,13 @@ ExpressionLayout::ExpressionLayout() :
 }
 
 void ExpressionLayout::draw(KDContext * ctx, KDPoint p, KDColor expressionColor, KDColor backgroundColor) {
-  int i = 0;
-  while (ExpressionLayout * c = editableChild(i++)) {
-    c->draw(ctx, p, expressionColor, backgroundColor);
-  }
-  render(ctx, absoluteOrigin().translatedBy(p), expressionColor, backgroundColor);
+  privateDraw(ctx, absoluteOrigin().translatedBy(p), expressionColor, backgroundColor);
 }
 
 KDPoint ExpressionLayout::origin() {
-  if (m_parent == nullptr) {
-    return absoluteOrigin();
-  } else {
-    return KDPoint(absoluteOrigin().x() - m_parent->absoluteOrigin().x(),
-        absoluteOrigin().y() - m_parent->absoluteOrigin().y());
-  }
-}
-
-KDPoint ExpressionLayout::absoluteOrigin() {
   if (!m_positioned) {
     if (m_parent != nullptr) {
-      m_frame.setOrigin(m_parent->absoluteOrigin().translatedBy(m_parent->positionOfChild(this)));
+      m_frame.setOrigin(m_parent->positionOfChild(this));
     } else {
       m_frame.setOrigin(KDPointZero);
     }
@@ -49,6 +36,13 @@ KDPoint ExpressionLayout::absoluteOrigin() {
   return m_frame.origin();
 }
 
+KDPoint ExpressionLayout::absoluteOrigin() {
+  if (m_parent == nullptr) {
+    return origin();
+  }
+  return m_parent->absoluteOrigin().translatedBy(origin());
+}
+
 KDSize ExpressionLayout::size() {
   if (!m_sized) {
     m_frame.setSize(computeSize());
@@ -66,14 +60,41 @@ KDCoordinate ExpressionLayout::baseline() {
 }
 
 void ExpressionLayout::invalidAllSizesPositionsAndBaselines() {
-  m_sized = false;
-  m_positioned = false;
-  m_baselined = false;
+  invalidSizePositionAndBaseline();
   for (int i = 0; i < numberOfChildren(); i++) {
     editableChild(i)->invalidAllSizesPositionsAndBaselines();
   }
 }
 
+void ExpressionLayout::invalidAncestorsSizesPositionsAndBaselines() {
+  ExpressionLayout * layout = this;
+  while (layout != nullptr) {
+    layout->invalidSizePositionAndBaseline();
+    /* The siblings of the modified layout are moved and some of them, like
+     * brackets, are sized according to their siblings. The children might be
+     * detached or being moved to another parent. */
+    ExpressionLayout * const * layoutChildren = const_cast<ExpressionLayout * const *>(layout->children());
+    for (int i = 0; i < layout->numberOfChildren(); i++) {
+      if (layoutChildren[i] != nullptr && layoutChildren[i]->parent() == layout) {
+        layoutChildren[i]->invalidSizePositionAndBaseline();
+      }
+    }
+    layout = layout->m_parent;
+  }
+}
+
+void ExpressionLayout::invalidSizePositionAndBaseline() {
+  m_sized = false;
+  m_positioned = false;
+  m_baselined = false;
+}
+
+void ExpressionLayout::setChildOrigin(ExpressionLayout * child, KDPoint origin) {
+  assert(child->parent() == this);
+  child->m_frame.setOrigin(origin);
+  child->m_positioned = true;
+}
+
 int ExpressionLayout::numberOfDescendants(bool includeSelf) const {
   int result = includeSelf ? 1 : 0;
   for (int i = 0; i < numberOfChildren(); i++) {
@@ -177,6 +198,7 @@ void ExpressionLayout::replaceChild(const ExpressionLayout * oldChild, Expressio
         const_cast<ExpressionLayout *>(newChild)->setParent(this);
       }
       op[i] = newChild;
+      invalidAncestorsSizesPositionsAndBaselines();
       break;
     }
   }
@@ -328,6 +350,16 @@ void ExpressionLayout::detachChildAtIndex(int i) {
     const_cast<ExpressionLayout *>(op[i])->setParent(nullptr);
   }
   op[i] = nullptr;
+  invalidAncestorsSizesPositionsAndBaselines();
+}
+
+void ExpressionLayout::privateDraw(KDContext * ctx, KDPoint p, KDColor expressionColor, KDColor backgroundColor) {
+  // p is the absolute origin of the layout: the children are positioned from it
+  int i = 0;
+  while (ExpressionLayout * c = editableChild(i++)) {
+    c->privateDraw(ctx, p.translatedBy(c->origin()), expressionColor, backgroundColor);
+  }
+  render(ctx, p, expressionColor, backgroundColor);
 }
 
 ExpressionLayoutCursor ExpressionLayout::cursorInDescendantsVerticalOf(VerticalDirection direction, ExpressionLayoutCursor cursor, bool * shouldRecomputeLayout) {
@@ -381,8 +413,9 @@ void ExpressionLayout::scoreCursorInDescendantsVerticalOf (
 {
   ExpressionLayoutCursor::Position * castedResultPosition = static_cast<ExpressionLayoutCursor::Position *>(resultPosition);
   KDPoint cursorMiddleLeft = cursor.middleLeftPoint();
-  bool layoutIsUnderOrAbove = direction == VerticalDirection::Up ? m_frame.isAbove(cursorMiddleLeft) : m_frame.isUnder(cursorMiddleLeft);
-  bool layoutContains = m_frame.contains(cursorMiddleLeft);
+  KDRect frame(absoluteOrigin(), size());
+  bool layoutIsUnderOrAbove = direction == VerticalDirection::Up ? frame.isAbove(cursorMiddleLeft) : frame.isUnder(cursorMiddleLeft);
+  bool layoutContains = frame.contains(cursorMiddleLeft);
 
   if (layoutIsUnderOrAbove) {
     // Check the distance to a Left cursor.
@@ -366,16 +366,22 @@ void HorizontalLayout::computeBaseline() {
 }
 
 KDPoint HorizontalLayout::positionOfChild(ExpressionLayout * child) {
+  /* All the children are positioned at once: looking for the index of the
+   * child and the position of its previous sibling for each child would be
+   * quadratic in the number of children. */
   KDCoordinate x = 0;
-  KDCoordinate y = 0;
-  int index = indexOfChild(child);
-  if (index > 0) {
-    ExpressionLayout * previousChild = editableChild(index-1);
-    assert(previousChild != nullptr);
-    x = previousChild->origin().x() + previousChild->size().width();
+  KDCoordinate baseline = this->baseline();
+  KDPoint result = KDPointZero;
+  int i = 0;
+  while (ExpressionLayout * c = editableChild(i++)) {
+    KDPoint position(x, baseline - c->baseline());
+    setChildOrigin(c, position);
+    if (c == child) {
+      result = position;
+    }
+    x += c->size().width();
   }
-  y = baseline() - child->baseline();
-  return KDPoint(x, y);
+  return result;
 }
 
 void HorizontalLayout::privateAddSibling(ExpressionLayoutCursor * cursor, ExpressionLayout * sibling, bool moveCursor) {
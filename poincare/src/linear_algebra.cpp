@@ -0,0 +1,292 @@
+#include <poincare/linear_algebra.h>
+#include <poincare/expression.h>
+#include <cmath>
+#include <assert.h>
+
+namespace Poincare {
+
+template<typename T>
+void LinearAlgebra::Multiply(const T * a, const T * b, T * result, int m, int n, int p) {
+  MultiplyKernel(a, b, result, m, n, p);
+}
+
+template<typename T>
+int LinearAlgebra::Inverse(T * a, int numberOfRows, int numberOfColumns) {
+  if (numberOfRows != numberOfColumns) {
+    return -1;
+  }
+  return InverseKernel(a, numberOfRows);
+}
+
+template<typename T>
+T LinearAlgebra::Determinant(T * a, int dim) {
+  return DeterminantKernel(a, dim);
+}
+
+template<typename T>
+void LinearAlgebra::Power(const T * a, int dim, int n, T * result) {
+  PowerKernel(a, dim, n, result);
+}
+
+/* Complex matrices */
+
+template<typename T>
+void LinearAlgebra::Multiply(const std::complex<T> * a, const std::complex<T> * b, std::complex<T> * result, int m, int n, int p) {
+  if (!IsReal(a, m*n) || !IsReal(b, n*p)) {
+    MultiplyKernel(a, b, result, m, n, p);
+    return;
+  }
+  T * realA = CreateRealParts(a, m*n);
+  T * realB = CreateRealParts(b, n*p);
+  T * realResult = new T[m*p];
+  MultiplyKernel(realA, realB, realResult, m, n, p);
+  CopyRealParts(realResult, result, m*p);
+  delete[] realA;
+  delete[] realB;
+  delete[] realResult;
+}
+
+template<typename T>
+int LinearAlgebra::Inverse(std::complex<T> * a, int numberOfRows, int numberOfColumns) {
+  if (numberOfRows != numberOfColumns) {
+    return -1;
+  }
+  int dim = numberOfRows;
+  if (!IsReal(a, dim*dim)) {
+    return InverseKernel(a, dim);
+  }
+  T * realA = CreateRealParts(a, dim*dim);
+  int result = InverseKernel(realA, dim);
+  if (result == 0) {
+    CopyRealParts(realA, a, dim*dim);
+  }
+  delete[] realA;
+  return result;
+}
+
+template<typename T>
+std::complex<T> LinearAlgebra::Determinant(std::complex<T> * a, int dim) {
+  if (!IsReal(a, dim*dim)) {
+    return DeterminantKernel(a, dim);
+  }
+  T * realA = CreateRealParts(a, dim*dim);
+  T result = DeterminantKernel(realA, dim);
+  delete[] realA;
+  return std::complex<T>(result);
+}
+
+template<typename T>
+void LinearAlgebra::Power(const std::complex<T> * a, int dim, int n, std::complex<T> * result) {
+  if (!IsReal(a, dim*dim)) {
+    PowerKernel(a, dim, n, result);
+    return;
+  }
+  T * realA = CreateRealParts(a, dim*dim);
+  T * realResult = new T[dim*dim];
+  PowerKernel(realA, dim, n, realResult);
+  CopyRealParts(realResult, result, dim*dim);
+  delete[] realA;
+  delete[] realResult;
+}
+
+template<typename T>
+bool LinearAlgebra::IsReal(const std::complex<T> * a, int numberOfOperands) {
+  for (int i = 0; i < numberOfOperands; i++) {
+    if (a[i].imag() != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+T * LinearAlgebra::CreateRealParts(const std::complex<T> * a, int numberOfOperands) {
+  T * result = new T[numberOfOperands];
+  for (int i = 0; i < numberOfOperands; i++) {
+    result[i] = a[i].real();
+  }
+  return result;
+}
+
+template<typename T>
+void LinearAlgebra::CopyRealParts(const T * a, std::complex<T> * result, int numberOfOperands) {
+  for (int i = 0; i < numberOfOperands; i++) {
+    result[i] = std::complex<T>(a[i]);
+  }
+}
+
+/* Kernels */
+
+template<typename T>
+void LinearAlgebra::MultiplyKernel(const T * a, const T * b, T * result, int m, int n, int p) {
+  for (int i = 0; i < m*p; i++) {
+    result[i] = 0;
+  }
+  /* The inner loop runs along the rows of b and result, which are contiguous,
+   * instead of along the columns of b. */
+  for (int k0 = 0; k0 < n; k0 += k_blockSize) {
+    int k1 = k0+k_blockSize < n ? k0+k_blockSize : n;
+    for (int j0 = 0; j0 < p; j0 += k_blockSize) {
+      int j1 = j0+k_blockSize < p ? j0+k_blockSize : p;
+      for (int i = 0; i < m; i++) {
+        T * resultRow = result+i*p;
+        for (int k = k0; k < k1; k++) {
+          const T aik = a[i*n+k];
+          const T * bRow = b+k*p;
+          for (int j = j0; j < j1; j++) {
+            resultRow[j] += aik*bRow[j];
+          }
+        }
+      }
+    }
+  }
+}
+
+template<typename T>
+int LinearAlgebra::LUDecompose(T * a, int dim, int * permutation) {
+  int sign = 1;
+  for (int i = 0; i < dim; i++) {
+    permutation[i] = i;
+  }
+  for (int k = 0; k < dim; k++) {
+    // Partial pivoting: choose the greatest coefficient of the column
+    int iPivot = k;
+    for (int i = k+1; i < dim; i++) {
+      if (std::abs(a[i*dim+k]) > std::abs(a[iPivot*dim+k])) {
+        iPivot = i;
+      }
+    }
+    if (std::abs(a[iPivot*dim+k]) < Expression::epsilon<double>()) {
+      return 0;
+    }
+    if (iPivot != k) {
+      for (int j = 0; j < dim; j++) {
+        T temp = a[iPivot*dim+j];
+        a[iPivot*dim+j] = a[k*dim+j];
+        a[k*dim+j] = temp;
+      }
+      int temp = permutation[iPivot];
+      permutation[iPivot] = permutation[k];
+      permutation[k] = temp;
+      sign = -sign;
+    }
+    const T pivot = a[k*dim+k];
+    for (int i = k+1; i < dim; i++) {
+      T factor = a[i*dim+k]/pivot;
+      a[i*dim+k] = factor;
+      for (int j = k+1; j < dim; j++) {
+        a[i*dim+j] -= factor*a[k*dim+j];
+      }
+    }
+  }
+  return sign;
+}
+
+template<typename T>
+int LinearAlgebra::InverseKernel(T * a, int dim) {
+  int * permutation = new int[dim];
+  if (LUDecompose(a, dim, permutation) == 0) {
+    delete[] permutation;
+    return -2;
+  }
+  /* Solve L*U*x = P*e_j for each column e_j of the identity. The columns of
+   * the inverse are computed in a row-major buffer of the transpose to keep
+   * the substitutions on contiguous data. */
+  T * inverseTranspose = new T[dim*dim];
+  for (int j = 0; j < dim; j++) {
+    T * x = inverseTranspose+j*dim;
+    for (int i = 0; i < dim; i++) {
+      x[i] = permutation[i] == j ? 1 : 0;
+    }
+    // Forward substitution with the unit lower triangular L
+    for (int i = 0; i < dim; i++) {
+      for (int k = 0; k < i; k++) {
+        x[i] -= a[i*dim+k]*x[k];
+      }
+    }
+    // Backward substitution with U
+    for (int i = dim-1; i >= 0; i--) {
+      for (int k = i+1; k < dim; k++) {
+        x[i] -= a[i*dim+k]*x[k];
+      }
+      x[i] /= a[i*dim+i];
+    }
+  }
+  for (int i = 0; i < dim; i++) {
+    for (int j = 0; j < dim; j++) {
+      a[i*dim+j] = inverseTranspose[j*dim+i];
+    }
+  }
+  delete[] inverseTranspose;
+  delete[] permutation;
+  return 0;
+}
+
+template<typename T>
+T LinearAlgebra::DeterminantKernel(T * a, int dim) {
+  int * permutation = new int[dim];
+  int sign = LUDecompose(a, dim, permutation);
+  delete[] permutation;
+  T determinant = sign;
+  for (int i = 0; sign != 0 && i < dim; i++) {
+    determinant *= a[i*dim+i];
+  }
+  return determinant;
+}
+
+template<typename T>
+void LinearAlgebra::PowerKernel(const T * a, int dim, int n, T * result) {
+  assert(n >= 0);
+  // Exponentiation by squaring
+  T * square = new T[dim*dim];
+  T * product = new T[dim*dim];
+  for (int i = 0; i < dim*dim; i++) {
+    square[i] = a[i];
+  }
+  Identity(result, dim);
+  while (n > 0) {
+    if (n & 1) {
+      MultiplyKernel(result, square, product, dim, dim, dim);
+      for (int i = 0; i < dim*dim; i++) {
+        result[i] = product[i];
+      }
+    }
+    n >>= 1;
+    if (n > 0) {
+      MultiplyKernel(square, square, product, dim, dim, dim);
+      T * temp = square;
+      square = product;
+      product = temp;
+    }
+  }
+  delete[] square;
+  delete[] product;
+}
+
+template<typename T>
+void LinearAlgebra::Identity(T * a, int dim) {
+  for (int i = 0; i < dim; i++) {
+    for (int j = 0; j < dim; j++) {
+      a[i*dim+j] = i == j ? 1 : 0;
+    }
+  }
+}
+
+template void LinearAlgebra::Multiply<float>(const float *, const float *, float *, int, int, int);
+template void LinearAlgebra::Multiply<double>(const double *, const double *, double *, int, int, int);
+template int LinearAlgebra::Inverse<float>(float *, int, int);
+template int LinearAlgebra::Inverse<double>(double *, int, int);
+template float LinearAlgebra::Determinant<float>(float *, int);
+template double LinearAlgebra::Determinant<double>(double *, int);
+template void LinearAlgebra::Power<float>(const float *, int, int, float *);
+template void LinearAlgebra::Power<double>(const double *, int, int, double *);
+template void LinearAlgebra::Multiply<float>(const std::complex<float> *, const std::complex<float> *, std::complex<float> *, int, int, int);
+template void LinearAlgebra::Multiply<double>(const std::complex<double> *, const std::complex<double> *, std::complex<double> *, int, int, int);
+template int LinearAlgebra::Inverse<float>(std::complex<float> *, int, int);
+template int LinearAlgebra::Inverse<double>(std::complex<double> *, int, int);
+template std::complex<float> LinearAlgebra::Determinant<float>(std::complex<float> *, int);
+template std::complex<double> LinearAlgebra::Determinant<double>(std::complex<double> *, int);
+template void LinearAlgebra::Power<float>(const std::complex<float> *, int, int, std::complex<float> *);
+template void LinearAlgebra::Power<double>(const std::complex<double> *, int, int, std::complex<double> *);
+
+}
@@ -29,6 +29,25 @@ Expression * Logarithm::clone() const {
   return new Logarithm(operands(), numberOfOperands(), true);
 }
 
+RealInterval Logarithm::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  // log(x, b) = ln(x)/ln(b)
+  RealInterval result = RealInterval::NaperianLogarithm(operand(0)->privateApproximateInterval(symbol, x, context, angleUnit));
+  RealInterval base = numberOfOperands() == 2 ? RealInterval::NaperianLogarithm(operand(1)->privateApproximateInterval(symbol, x, context, angleUnit)) : RealInterval::Approximate(std::log(10.0));
+  return RealInterval::Division(result, base);
+}
+
+DualNumber Logarithm::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  // log(a)' = a'/(a*ln(10))
+  DualNumber a = operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  DualNumber result = DualNumber::Composition(a, computeOnComplex<double>(a.value(), angleUnit), 1.0/(a.value()*std::log(10.0)));
+  if (numberOfOperands() == 1) {
+    return result;
+  }
+  // log(a, b) = log(a)/log(b)
+  DualNumber b = operand(1)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  return DualNumber::Division(result, DualNumber::Composition(b, computeOnComplex<double>(b.value(), angleUnit), 1.0/(b.value()*std::log(10.0))));
+}
+
 template<typename T>
 std::complex<T> Logarithm::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   /* log has a branch cut on ]-inf, 0]: it is then multivalued on this cut. We
@@ -132,6 +151,22 @@ Expression * Logarithm::shallowReduce(Context& context, AngleUnit angleUnit) {
   return this;
 }
 
+Expression * Logarithm::createDerivative(char symbol, AngleUnit angleUnit) const {
+  // The base is a constant
+  if (numberOfOperands() == 2 && operand(1)->polynomialDegree(symbol) != 0) {
+    return nullptr;
+  }
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // log(u, b)' = u'/(u*ln(b))
+  Expression * base = numberOfOperands() == 2 ? operand(1)->clone() : new Rational(10);
+  Power * inverseLogarithm = new Power(new NaperianLogarithm(base, false), new Rational(-1), false);
+  const Expression * multOperands[3] = {operandDerivative, new Power(operand(0), new Rational(-1), true), inverseLogarithm};
+  return new Multiplication(multOperands, 3, false);
+}
+
 bool Logarithm::parentIsAPowerOfSameBase() const {
   // We look for expressions of types e^ln(x) or e^(ln(x)) where ln is this
   const Expression * parentExpression = parent();
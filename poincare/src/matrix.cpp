@@ -5,11 +5,14 @@ extern "C" {
 #include <poincare/global_context.h>
 #include <poincare/matrix.h>
 #include <poincare/addition.h>
+#include <poincare/arithmetic.h>
 #include <poincare/decimal.h>
+#include <poincare/linear_algebra.h>
 #include <poincare/undefined.h>
 #include <poincare/division.h>
 #include <poincare/subtraction.h>
 #include <poincare/multiplication.h>
+#include <poincare/rational.h>
 #include "layout/matrix_layout.h"
 #include <cmath>
 #include <float.h>
@@ -106,6 +109,9 @@ void Matrix::rowCanonize(Context & context, AngleUnit angleUnit, Multiplication
   for (int i = 0; i < numberOfOperands(); i++) {
     editableOperand(i)->deepReduce(context, angleUnit);
   }
+  if (rowCanonizeRationals(determinant)) {
+    return;
+  }
   int m = numberOfRows();
   int n = numberOfColumns();
 
@@ -163,56 +169,101 @@ void Matrix::rowCanonize(Context & context, AngleUnit angleUnit, Multiplication
   }
 }
 
-template<typename T>
-void Matrix::ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * determinant) {
+bool Matrix::rowCanonizeRationals(Multiplication * determinant) {
+  for (int i = 0; i < numberOfOperands(); i++) {
+    if (operand(i)->type() != Type::Rational) {
+      return false;
+    }
+  }
+  int m = numberOfRows();
+  int n = numberOfColumns();
+  /* Multiply each row by the lcm of its denominators to get an integer
+   * matrix. The scale of each row follows it when rows are swapped. */
+  Integer * a = new Integer[m*n];
+  Integer * scales = new Integer[m];
+  for (int i = 0; i < m; i++) {
+    scales[i] = Integer(1);
+    for (int j = 0; j < n; j++) {
+      Integer denominator = static_cast<const Rational *>(operand(i*n+j))->denominator();
+      scales[i] = Arithmetic::LCM(&scales[i], &denominator);
+    }
+    for (int j = 0; j < n; j++) {
+      const Rational * r = static_cast<const Rational *>(operand(i*n+j));
+      a[i*n+j] = Integer::Multiplication(r->numerator(), Integer::Division(scales[i], r->denominator()).quotient);
+    }
+  }
+
+  /* Bareiss fraction-free Gauss-Jordan elimination: with p the current pivot
+   * and q the previous one, every other row is updated as
+   * a[i][j] = (p*a[i][j]-a[i][k]*a[h][j])/q. The divisions are exact as every
+   * coefficient is a minor of the scaled matrix. At the end, all the pivots
+   * are equal to the last one. */
+  Integer previousPivot(1);
   int h = 0; // row pivot
   int k = 0; // column pivot
-
-  while (h < numberOfRows && k < numberOfColumns) {
+  while (h < m && k < n) {
     // Find the first non-null pivot
     int iPivot = h;
-    while (iPivot < numberOfRows && std::abs(array[iPivot*numberOfColumns+k]) < Expression::epsilon<double>()) {
+    while (iPivot < m && a[iPivot*n+k].isZero()) {
       iPivot++;
     }
-    if (iPivot == numberOfRows) {
+    if (iPivot == m) {
       // No non-null coefficient in this column, skip
       k++;
       // Update determinant: det *= 0
-      if (determinant) { *determinant *= 0.0; }
-    } else {
-      // Swap row h and iPivot
-      if (iPivot != h) {
-        for (int col = h; col < numberOfColumns; col++) {
-          // Swap array[iPivot, col] and array[h, col]
-          T temp = array[iPivot*numberOfColumns+col];
-          array[iPivot*numberOfColumns+col] = array[h*numberOfColumns+col];
-          array[h*numberOfColumns+col] = temp;
-        }
-        // Update determinant: det *= -1
-        if (determinant) { *determinant *= -1.0; }
-      }
-      /* Set to 1 array[h][k] by linear combination */
-      T divisor = array[h*numberOfColumns+k];
-      // Update determinant: det *= divisor
-      if (determinant) { *determinant *= divisor; }
-      for (int j = k+1; j < numberOfColumns; j++) {
-        array[h*numberOfColumns+j] /= divisor;
+      if (determinant) { determinant->addOperand(new Rational(0)); }
+      continue;
+    }
+    // Swap row h and iPivot
+    if (iPivot != h) {
+      for (int col = 0; col < n; col++) {
+        Integer temp = a[iPivot*n+col];
+        a[iPivot*n+col] = a[h*n+col];
+        a[h*n+col] = temp;
       }
-      array[h*numberOfColumns+k] = 1;
-
-      /* Set to 0 all M[i][j] i != h, j > k by linear combination */
-      for (int i = 0; i < numberOfRows; i++) {
-        if (i == h) { continue; }
-        T factor = array[i*numberOfColumns+k];
-        for (int j = k+1; j < numberOfColumns; j++) {
-          array[i*numberOfColumns+j] -= array[h*numberOfColumns+j]*factor;
+      Integer temp = scales[iPivot];
+      scales[iPivot] = scales[h];
+      scales[h] = temp;
+      // Update determinant: det *= -1
+      if (determinant) { determinant->addOperand(new Rational(-1)); }
+    }
+    Integer pivot = a[h*n+k];
+    for (int i = 0; i < m; i++) {
+      if (i == h) { continue; }
+      const Integer & factor = a[i*n+k];
+      for (int j = 0; j < n; j++) {
+        if (j == k) { continue; }
+        Integer product = Integer::Multiplication(pivot, a[i*n+j]);
+        if (!factor.isZero() && !a[h*n+j].isZero()) {
+          product = Integer::Subtraction(product, Integer::Multiplication(factor, a[h*n+j]));
         }
-        array[i*numberOfColumns+k] = 0;
+        IntegerDivision division = Integer::Division(product, previousPivot);
+        assert(division.remainder.isZero());
+        a[i*n+j] = division.quotient;
       }
-      h++;
-      k++;
+      a[i*n+k] = Integer(0);
     }
+    previousPivot = pivot;
+    h++;
+    k++;
+  }
+
+  /* The pivot rows are divided by the last pivot. Other rows are null. Once
+   * rows are unscaled, the last pivot is the product of the pivots of the
+   * Gaussian elimination. */
+  if (determinant && h > 0) {
+    Integer scale(1);
+    for (int i = 0; i < h; i++) {
+      scale = Integer::Multiplication(scale, scales[i]);
+    }
+    determinant->addOperand(new Rational(previousPivot, scale));
+  }
+  for (int i = 0; i < m*n; i++) {
+    replaceOperand(operand(i), new Rational(a[i], previousPivot), true);
   }
+  delete[] a;
+  delete[] scales;
+  return true;
 }
 
 ExpressionLayout * Matrix::createLayout(PrintFloat::Mode floatDisplayMode, int numberOfSignificantDigits) const {
@@ -250,35 +301,7 @@ int Matrix::rank(Context & context, AngleUnit angleUnit, bool inPlace) {
 
 template<typename T>
 int Matrix::ArrayInverse(T * array, int numberOfRows, int numberOfColumns) {
-  if (numberOfRows != numberOfColumns) {
-    return -1;
-  }
-  int dim = numberOfRows;
-  /* Create the matrix inv = (A|I) with A the input matrix and I the dim identity matrix */
-  T * operands = new T[dim*2*dim];
-  for (int i = 0; i < dim; i++) {
-    for (int j = 0; j < dim; j++) {
-      operands[i*2*dim+j] = array[i*numberOfColumns+j];
-    }
-    for (int j = dim; j < 2*dim; j++) {
-      operands[i*2*dim+j] = j-dim == i ? 1 : 0;
-    }
-  }
-  ArrayRowCanonize(operands, dim, 2*dim);
-  // Check inversibility
-  for (int i = 0; i < dim; i++) {
-    T one = 1.0;
-    if (std::abs(operands[i*2*dim+i] - one) > Expression::epsilon<float>()) {
-      return -2;
-    }
-  }
-  for (int i = 0; i < dim; i++) {
-    for (int j = 0; j < dim; j++) {
-      array[i*numberOfColumns+j] = operands[i*2*dim+j+dim];
-    }
-  }
-  delete [] operands;
-  return 0;
+  return LinearAlgebra::Inverse(array, numberOfRows, numberOfColumns);
 }
 
 #if MATRIX_EXACT_REDUCING
@@ -373,7 +396,5 @@ template int Matrix::ArrayInverse<float>(float *, int, int);
 template int Matrix::ArrayInverse<double>(double *, int, int);
 template int Matrix::ArrayInverse<std::complex<float>>(std::complex<float> *, int, int);
 template int Matrix::ArrayInverse<std::complex<double>>(std::complex<double> *, int, int);
-template void Matrix::ArrayRowCanonize<std::complex<float> >(std::complex<float>*, int, int, std::complex<float>*);
-template void Matrix::ArrayRowCanonize<std::complex<double> >(std::complex<double>*, int, int, std::complex<double>*);
 
 }
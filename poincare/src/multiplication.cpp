@@ -2,9 +2,11 @@
 #include <poincare/addition.h>
 #include <poincare/arithmetic.h>
 #include <poincare/division.h>
+#include <poincare/linear_algebra.h>
 #include <poincare/matrix.h>
 #include <poincare/opposite.h>
 #include <poincare/parenthesis.h>
+#include <poincare/polynomial.h>
 #include <poincare/power.h>
 #include <poincare/rational.h>
 #include <poincare/simplification_root.h>
@@ -113,26 +115,34 @@ Expression * Multiplication::setSign(Sign s, Context & context, AngleUnit angleU
   return shallowReduce(context, angleUnit);
 }
 
+RealInterval Multiplication::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  RealInterval result = operand(0)->privateApproximateInterval(symbol, x, context, angleUnit);
+  for (int i = 1; i < numberOfOperands(); i++) {
+    result = RealInterval::Multiplication(result, operand(i)->privateApproximateInterval(symbol, x, context, angleUnit));
+  }
+  return result;
+}
+
+DualNumber Multiplication::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber result = operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  for (int i = 1; i < numberOfOperands(); i++) {
+    result = DualNumber::Multiplication(result, operand(i)->privateApproximateWithDerivative(symbol, x, context, angleUnit));
+  }
+  return result;
+}
+
 template<typename T>
 std::complex<T> Multiplication::compute(const std::complex<T> c, const std::complex<T> d) {
   return c*d;
 }
 
 template<typename T>
-MatrixComplex<T> Multiplication::computeOnMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n) {
+MatrixComplex<T> Multiplication::computeOnMatrices(const MatrixComplex<T> & m, const MatrixComplex<T> & n) {
   if (m.numberOfColumns() != n.numberOfRows()) {
     return MatrixComplex<T>::Undefined();
   }
   std::complex<T> * operands = new std::complex<T> [m.numberOfRows()*n.numberOfColumns()];
-  for (int i = 0; i < m.numberOfRows(); i++) {
-    for (int j = 0; j < n.numberOfColumns(); j++) {
-      std::complex<T> c(0.0);
-      for (int k = 0; k < m.numberOfColumns(); k++) {
-        c += m.complexOperand(i*m.numberOfColumns()+k)*n.complexOperand(k*n.numberOfColumns()+j);
-      }
-      operands[i*n.numberOfColumns()+j] = c;
-    }
-  }
+  LinearAlgebra::Multiply(m.complexOperands(), n.complexOperands(), operands, m.numberOfRows(), m.numberOfColumns(), n.numberOfColumns());
   MatrixComplex<T> result = MatrixComplex<T>(operands, m.numberOfRows(), n.numberOfColumns());
   delete[] operands;
   return result;
@@ -140,15 +150,7 @@ MatrixComplex<T> Multiplication::computeOnMatrices(const MatrixComplex<T> m, con
 
 template<typename T>
 void Multiplication::computeOnArrays(T * m, T * n, T * result, int mNumberOfColumns, int mNumberOfRows, int nNumberOfColumns) {
-  for (int i = 0; i < mNumberOfRows; i++) {
-    for (int j = 0; j < nNumberOfColumns; j++) {
-      T res = 0.0f;
-      for (int k = 0; k < mNumberOfColumns; k++) {
-        res+= m[i*mNumberOfColumns+k]*n[k*nNumberOfColumns+j];
-      }
-      result[i*nNumberOfColumns+j] = res;
-    }
-  }
+  LinearAlgebra::Multiply(m, n, result, mNumberOfRows, mNumberOfColumns, nNumberOfColumns);
 }
 
 bool Multiplication::HaveSameNonRationalFactors(const Expression * e1, const Expression * e2) {
@@ -178,6 +180,30 @@ Expression * Multiplication::shallowReduce(Context& context, AngleUnit angleUnit
   return privateShallowReduce(context, angleUnit, true, true);
 }
 
+Expression * Multiplication::createDerivative(char symbol, AngleUnit angleUnit) const {
+  // (u*v)' = u'*v+u*v'
+  Addition * derivative = new Addition();
+  for (int i = 0; i < numberOfOperands(); i++) {
+    // Skip the factors which do not depend on the symbol
+    if (operand(i)->polynomialDegree(symbol) == 0) {
+      continue;
+    }
+    Expression * operandDerivative = operand(i)->createDerivative(symbol, angleUnit);
+    if (operandDerivative == nullptr) {
+      delete derivative;
+      return nullptr;
+    }
+    Multiplication * term = static_cast<Multiplication *>(clone());
+    term->replaceOperand(term->operand(i), operandDerivative, true);
+    derivative->addOperand(term);
+  }
+  if (derivative->numberOfOperands() == 0) {
+    delete derivative;
+    return new Rational(0);
+  }
+  return derivative;
+}
+
 Expression * Multiplication::privateShallowReduce(Context & context, AngleUnit angleUnit, bool shouldExpand, bool canBeInterrupted) {
   Expression * e = Expression::shallowReduce(context, angleUnit);
   if (e != this) {
@@ -367,6 +393,12 @@ Expression * Multiplication::privateShallowReduce(Context & context, AngleUnit a
   if (shouldExpand && parent()->type() != Type::Multiplication) {
     for (int i=0; i<numberOfOperands(); i++) {
       if (operand(i)->type() == Type::Addition) {
+        /* If the multiplication is a polynomial, its expansion is computed on
+         * the Polynomial type. */
+        Polynomial product;
+        if (Polynomial::FromExpression(this, &product)) {
+          return replaceWith(product.createExpression(), true)->deepReduce(context, angleUnit);
+        }
         return distributeOnOperandAtIndex(i, context, angleUnit);
       }
     }
@@ -724,8 +756,8 @@ void Multiplication::addMissingFactors(Expression * factor, Context & context, A
   sortOperands(SimplificationOrder, false);
 }
 
-template MatrixComplex<float> Multiplication::computeOnComplexAndMatrix<float>(std::complex<float> const, const MatrixComplex<float>);
-template MatrixComplex<double> Multiplication::computeOnComplexAndMatrix<double>(std::complex<double> const, const MatrixComplex<double>);
+template MatrixComplex<float> Multiplication::computeOnComplexAndMatrix<float>(std::complex<float> const, const MatrixComplex<float> &);
+template MatrixComplex<double> Multiplication::computeOnComplexAndMatrix<double>(std::complex<double> const, const MatrixComplex<double> &);
 template std::complex<float> Multiplication::compute<float>(const std::complex<float>, const std::complex<float>);
 template std::complex<double> Multiplication::compute<double>(const std::complex<double>, const std::complex<double>);
 template void Multiplication::computeOnArrays<double>(double * m, double * n, double * result, int mNumberOfColumns, int mNumberOfRows, int nNumberOfColumns);
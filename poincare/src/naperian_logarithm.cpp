@@ -2,6 +2,9 @@
 #include <poincare/symbol.h>
 #include <poincare/logarithm.h>
 #include <poincare/simplification_engine.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
+#include <poincare/multiplication.h>
 extern "C" {
 #include <assert.h>
 #include <stdlib.h>
@@ -36,6 +39,24 @@ Expression * NaperianLogarithm::shallowReduce(Context& context, AngleUnit angleU
   return l->shallowReduce(context, angleUnit);
 }
 
+Expression * NaperianLogarithm::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // ln(u)' = u'/u
+  return new Multiplication(operandDerivative, new Power(operand(0), new Rational(-1), true), false);
+}
+
+RealInterval NaperianLogarithm::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  return RealInterval::NaperianLogarithm(operand(0)->privateApproximateInterval(symbol, x, context, angleUnit));
+}
+
+DualNumber NaperianLogarithm::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber a = operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  return DualNumber::Composition(a, computeOnComplex<double>(a.value(), angleUnit), 1.0/a.value());
+}
+
 template<typename T>
 std::complex<T> NaperianLogarithm::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   /* ln has a branch cut on ]-inf, 0]: it is then multivalued on this cut. We
@@ -43,6 +43,14 @@ bool Opposite::needParenthesisWithParent(const Expression * e) const {
   return e->isOfType(types, 7);
 }
 
+RealInterval Opposite::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  return RealInterval::Opposite(operand(0)->privateApproximateInterval(symbol, x, context, angleUnit));
+}
+
+DualNumber Opposite::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  return DualNumber::Opposite(operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit));
+}
+
 template<typename T>
 std::complex<T> Opposite::compute(const std::complex<T> c, AngleUnit angleUnit) {
   return -c;
@@ -65,6 +73,15 @@ Expression * Opposite::shallowReduce(Context& context, AngleUnit angleUnit) {
   return m->shallowReduce(context, angleUnit);
 }
 
+Expression * Opposite::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // (-u)' = -u'
+  return new Opposite(operandDerivative, false);
+}
+
 ExpressionLayout * Opposite::createLayout(PrintFloat::Mode floatDisplayMode, int numberOfSignificantDigits) const {
   HorizontalLayout * result = new HorizontalLayout(new CharLayout('-'), false);
   if (operand(0)->type() == Type::Opposite) {
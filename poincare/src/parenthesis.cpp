@@ -33,6 +33,18 @@ Expression * Parenthesis::shallowReduce(Context& context, AngleUnit angleUnit) {
   return replaceWith(editableOperand(0), true);
 }
 
+Expression * Parenthesis::createDerivative(char symbol, AngleUnit angleUnit) const {
+  return operand(0)->createDerivative(symbol, angleUnit);
+}
+
+RealInterval Parenthesis::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  return operand(0)->privateApproximateInterval(symbol, x, context, angleUnit);
+}
+
+DualNumber Parenthesis::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  return operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+}
+
 template<typename T>
 Evaluation<T> * Parenthesis::templatedApproximate(Context& context, AngleUnit angleUnit) const {
   return operand(0)->privateApproximate(T(), context, angleUnit);
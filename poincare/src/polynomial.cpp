@@ -0,0 +1,482 @@
+#include <poincare/polynomial.h>
+#include <poincare/addition.h>
+#include <poincare/multiplication.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
+#include <ion/charset.h>
+#include <string.h>
+#include <assert.h>
+
+namespace Poincare {
+
+Polynomial::Polynomial() :
+  m_terms(nullptr),
+  m_numberOfTerms(0),
+  m_numberOfVariables(0)
+{
+}
+
+Polynomial::Polynomial(const Integer & numerator, const Integer & denominator) :
+  Polynomial()
+{
+  if (numerator.isZero()) {
+    return;
+  }
+  allocateTerms(1);
+  m_terms[0].numerator = numerator;
+  m_terms[0].denominator = denominator;
+}
+
+Polynomial Polynomial::Variable(char name) {
+  Polynomial p(Integer(1));
+  p.m_variables[0] = name;
+  p.m_numberOfVariables = 1;
+  p.m_terms[0].exponents[0] = 1;
+  return p;
+}
+
+Polynomial::~Polynomial() {
+  delete[] m_terms;
+}
+
+Polynomial::Polynomial(const Polynomial & other) :
+  Polynomial()
+{
+  *this = other;
+}
+
+Polynomial::Polynomial(Polynomial && other) :
+  m_terms(other.m_terms),
+  m_numberOfTerms(other.m_numberOfTerms),
+  m_numberOfVariables(0)
+{
+  copyVariables(other);
+  other.m_terms = nullptr;
+  other.m_numberOfTerms = 0;
+}
+
+Polynomial & Polynomial::operator=(const Polynomial & other) {
+  if (this != &other) {
+    allocateTerms(other.m_numberOfTerms);
+    for (int i = 0; i < m_numberOfTerms; i++) {
+      m_terms[i] = other.m_terms[i];
+    }
+    copyVariables(other);
+  }
+  return *this;
+}
+
+Polynomial & Polynomial::operator=(Polynomial && other) {
+  if (this != &other) {
+    delete[] m_terms;
+    m_terms = other.m_terms;
+    m_numberOfTerms = other.m_numberOfTerms;
+    copyVariables(other);
+    other.m_terms = nullptr;
+    other.m_numberOfTerms = 0;
+  }
+  return *this;
+}
+
+bool Polynomial::IsVariable(const Expression * e) {
+  if (e->type() != Expression::Type::Symbol) {
+    return false;
+  }
+  const Symbol * s = static_cast<const Symbol *>(e);
+  return s->name() != Ion::Charset::IComplex && !s->isMatrixSymbol();
+}
+
+bool Polynomial::FromExpression(const Expression * e, Polynomial * result) {
+  switch (e->type()) {
+    case Expression::Type::Rational:
+    {
+      const Rational * r = static_cast<const Rational *>(e);
+      *result = Polynomial(r->numerator(), r->denominator());
+      return true;
+    }
+    case Expression::Type::Symbol:
+      if (!IsVariable(e)) {
+        return false;
+      }
+      *result = Variable(static_cast<const Symbol *>(e)->name());
+      return true;
+    case Expression::Type::Addition:
+    case Expression::Type::Multiplication:
+    {
+      bool isAddition = e->type() == Expression::Type::Addition;
+      if (!FromExpression(e->operand(0), result)) {
+        return false;
+      }
+      for (int i = 1; i < e->numberOfOperands(); i++) {
+        Polynomial operand;
+        if (!FromExpression(e->operand(i), &operand)) {
+          return false;
+        }
+        if (isAddition) {
+          if (!CanAdd(*result, operand)) {
+            return false;
+          }
+          *result = Addition(*result, operand);
+        } else {
+          if (!CanMultiply(*result, operand)) {
+            return false;
+          }
+          *result = Multiplication(*result, operand);
+        }
+        if (result->numberOfTerms() > k_maxNumberOfTerms) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case Expression::Type::Power:
+    {
+      if (e->operand(1)->type() != Expression::Type::Rational) {
+        return false;
+      }
+      const Rational * exponent = static_cast<const Rational *>(e->operand(1));
+      if (!exponent->denominator().isOne() || exponent->numerator().isNegative() || Integer(k_maxDegree).isLowerThan(exponent->numerator())) {
+        return false;
+      }
+      // Powers of sums are only expanded as long as the reducer would expand them
+      if (e->operand(0)->type() == Expression::Type::Addition && !Poincare::Power::MultinomeCanBeExpanded(e->operand(0)->numberOfOperands(), exponent->numerator())) {
+        return false;
+      }
+      int n = exponent->numerator().extractedInt();
+      Polynomial base;
+      if (!FromExpression(e->operand(0), &base) || !CanPower(base, n)) {
+        return false;
+      }
+      *result = Power(base, n);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+Expression * Polynomial::createExpression() const {
+  if (m_numberOfTerms == 0) {
+    return new Rational(0);
+  }
+  Expression ** monomials = new Expression *[m_numberOfTerms];
+  for (int i = 0; i < m_numberOfTerms; i++) {
+    const Term & t = m_terms[i];
+    Expression * coefficient = new Rational(t.numerator, t.denominator);
+    Poincare::Multiplication * m = new Poincare::Multiplication(&coefficient, 1, false);
+    for (int j = 0; j < m_numberOfVariables; j++) {
+      if (t.exponents[j] == 0) {
+        continue;
+      }
+      Expression * v = new Symbol(m_variables[j]);
+      if (t.exponents[j] > 1) {
+        v = new Poincare::Power(v, new Rational(t.exponents[j]), false);
+      }
+      m->addOperand(v);
+    }
+    monomials[i] = m;
+  }
+  Expression * result = m_numberOfTerms == 1 ? monomials[0] : new Poincare::Addition(monomials, m_numberOfTerms, false);
+  delete[] monomials;
+  return result;
+}
+
+int Polynomial::degree(char variable) const {
+  int index = variableIndex(variable);
+  if (index < 0) {
+    return 0;
+  }
+  int d = 0;
+  for (int i = 0; i < m_numberOfTerms; i++) {
+    d = m_terms[i].exponents[index] > d ? m_terms[i].exponents[index] : d;
+  }
+  return d;
+}
+
+bool Polynomial::isUnivariate() const {
+  int variable = -1;
+  for (int i = 0; i < m_numberOfTerms; i++) {
+    for (int j = 0; j < m_numberOfVariables; j++) {
+      if (m_terms[i].exponents[j] == 0) {
+        continue;
+      }
+      if (variable >= 0 && variable != j) {
+        return false;
+      }
+      variable = j;
+    }
+  }
+  return true;
+}
+
+Polynomial Polynomial::Addition(const Polynomial & a, const Polynomial & b) {
+  Polynomial ua, ub;
+  Unify(a, b, &ua, &ub);
+  Polynomial result;
+  result.copyVariables(ua);
+  result.allocateTerms(ua.m_numberOfTerms + ub.m_numberOfTerms);
+  // Merge the sorted terms of ua and ub
+  int i = 0, j = 0, k = 0;
+  while (i < ua.m_numberOfTerms || j < ub.m_numberOfTerms) {
+    int c = i == ua.m_numberOfTerms ? 1 : (j == ub.m_numberOfTerms ? -1 : CompareExponents(ua.m_terms[i], ub.m_terms[j], ua.m_numberOfVariables));
+    if (c < 0) {
+      result.m_terms[k++] = ua.m_terms[i++];
+    } else if (c > 0) {
+      result.m_terms[k++] = ub.m_terms[j++];
+    } else {
+      AddCoefficients(ua.m_terms[i++], ub.m_terms[j++], &result.m_terms[k]);
+      if (!result.m_terms[k].numerator.isZero()) {
+        k++;
+      }
+    }
+  }
+  result.m_numberOfTerms = k;
+  return result;
+}
+
+Polynomial Polynomial::Subtraction(const Polynomial & a, const Polynomial & b) {
+  return Addition(a, Multiplication(b, Polynomial(Integer(-1))));
+}
+
+Polynomial Polynomial::Multiplication(const Polynomial & a, const Polynomial & b) {
+  Polynomial ua, ub;
+  Unify(a, b, &ua, &ub);
+  /* Multiplying ub by a term keeps its terms sorted: the partial products are
+   * merged into the result one term of ua at a time. */
+  Polynomial result;
+  result.copyVariables(ua);
+  for (int i = 0; i < ua.m_numberOfTerms; i++) {
+    result = Addition(result, MultiplicationByTerm(ub, ua.m_terms[i]));
+  }
+  return result;
+}
+
+Polynomial Polynomial::Power(const Polynomial & a, int n) {
+  assert(n >= 0);
+  // Exponentiation by squaring
+  Polynomial result(Integer(1));
+  Polynomial square = a;
+  while (n > 0) {
+    if (n & 1) {
+      result = Multiplication(result, square);
+    }
+    n >>= 1;
+    if (n > 0) {
+      square = Multiplication(square, square);
+    }
+  }
+  return result;
+}
+
+PolynomialDivision Polynomial::Division(const Polynomial & numerator, const Polynomial & denominator) {
+  assert(!denominator.isZero());
+  Polynomial remainder, d;
+  Unify(numerator, denominator, &remainder, &d);
+  assert(remainder.isUnivariate() && d.isUnivariate() && Addition(numerator, denominator).isUnivariate());
+  /* In one variable, the terms are sorted by increasing degree: the leading
+   * term is the last one. */
+  const Term & leading = d.m_terms[d.m_numberOfTerms-1];
+  Term inverseLeading = leading;
+  inverseLeading.numerator = leading.denominator;
+  inverseLeading.denominator = leading.numerator;
+  if (inverseLeading.denominator.isNegative()) {
+    inverseLeading.numerator.setNegative(!inverseLeading.numerator.isNegative());
+    inverseLeading.denominator.setNegative(false);
+  }
+  int variable = 0;
+  while (variable < d.m_numberOfVariables && remainder.degree(d.m_variables[variable]) == 0 && d.degree(d.m_variables[variable]) == 0) {
+    variable++;
+  }
+  int leadingDegree = variable < d.m_numberOfVariables ? leading.exponents[variable] : 0;
+  Polynomial quotient;
+  quotient.copyVariables(d);
+  while (!remainder.isZero()) {
+    const Term & r = remainder.m_terms[remainder.m_numberOfTerms-1];
+    int remainderDegree = variable < remainder.m_numberOfVariables ? r.exponents[variable] : 0;
+    if (remainderDegree < leadingDegree) {
+      break;
+    }
+    Term t;
+    MultiplyCoefficients(r, inverseLeading, &t);
+    memset(t.exponents, 0, sizeof(t.exponents));
+    if (variable < d.m_numberOfVariables) {
+      t.exponents[variable] = remainderDegree - leadingDegree;
+    }
+    Polynomial monomial;
+    monomial.copyVariables(d);
+    monomial.allocateTerms(1);
+    monomial.m_terms[0] = t;
+    quotient = Addition(quotient, monomial);
+    remainder = Subtraction(remainder, MultiplicationByTerm(d, t));
+  }
+  PolynomialDivision div = {.quotient = quotient, .remainder = remainder};
+  return div;
+}
+
+Polynomial Polynomial::GCD(const Polynomial & a, const Polynomial & b) {
+  Polynomial u = a;
+  Polynomial v = b;
+  while (!v.isZero()) {
+    Polynomial r = Division(u, v).remainder;
+    u = static_cast<Polynomial &&>(v);
+    v = static_cast<Polynomial &&>(r);
+  }
+  if (u.isZero()) {
+    return u;
+  }
+  const Term & leading = u.m_terms[u.m_numberOfTerms-1];
+  return Division(u, Polynomial(leading.numerator, leading.denominator)).quotient;
+}
+
+bool Polynomial::CanAdd(const Polynomial & a, const Polynomial & b) {
+  return NumberOfUnifiedVariables(a, b) <= k_maxNumberOfVariables;
+}
+
+bool Polynomial::CanMultiply(const Polynomial & a, const Polynomial & b) {
+  if (a.m_numberOfTerms*b.m_numberOfTerms > k_maxNumberOfProducts) {
+    return false;
+  }
+  for (int i = 0; i < b.m_numberOfVariables; i++) {
+    if (a.degree(b.m_variables[i]) + b.degree(b.m_variables[i]) > k_maxDegree) {
+      return false;
+    }
+  }
+  return NumberOfUnifiedVariables(a, b) <= k_maxNumberOfVariables;
+}
+
+bool Polynomial::CanPower(const Polynomial & a, int n) {
+  if (n <= 1) {
+    return true;
+  }
+  for (int i = 0; i < a.m_numberOfVariables; i++) {
+    if (a.degree(a.m_variables[i])*n > k_maxDegree) {
+      return false;
+    }
+  }
+  /* (a0+...+a(m-1))^n has at most BinomialCoefficient(n+m-1, m-1) terms. The
+   * binomial coefficient is computed incrementally as long as it stays below
+   * k_maxNumberOfTerms. */
+  int m = a.m_numberOfTerms;
+  int numberOfTerms = 1;
+  for (int k = 1; k < m; k++) {
+    numberOfTerms = numberOfTerms*(n+k)/k;
+    if (numberOfTerms > k_maxNumberOfTerms) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Polynomial::allocateTerms(int numberOfTerms) {
+  delete[] m_terms;
+  m_terms = numberOfTerms > 0 ? new Term[numberOfTerms] : nullptr;
+  m_numberOfTerms = numberOfTerms;
+  for (int i = 0; i < numberOfTerms; i++) {
+    memset(m_terms[i].exponents, 0, sizeof(m_terms[i].exponents));
+  }
+}
+
+void Polynomial::copyVariables(const Polynomial & other) {
+  memcpy(m_variables, other.m_variables, sizeof(m_variables));
+  m_numberOfVariables = other.m_numberOfVariables;
+}
+
+int Polynomial::variableIndex(char name) const {
+  for (int i = 0; i < m_numberOfVariables; i++) {
+    if (m_variables[i] == name) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int Polynomial::NumberOfUnifiedVariables(const Polynomial & a, const Polynomial & b) {
+  int numberOfVariables = a.m_numberOfVariables;
+  for (int i = 0; i < b.m_numberOfVariables; i++) {
+    if (a.variableIndex(b.m_variables[i]) < 0) {
+      numberOfVariables++;
+    }
+  }
+  return numberOfVariables;
+}
+
+void Polynomial::Unify(const Polynomial & a, const Polynomial & b, Polynomial * unifiedA, Polynomial * unifiedB) {
+  // Merge the sorted variables of a and b
+  char variables[2*k_maxNumberOfVariables];
+  int numberOfVariables = 0;
+  int i = 0, j = 0;
+  while (i < a.m_numberOfVariables || j < b.m_numberOfVariables) {
+    if (j == b.m_numberOfVariables || (i < a.m_numberOfVariables && a.m_variables[i] < b.m_variables[j])) {
+      variables[numberOfVariables++] = a.m_variables[i++];
+    } else {
+      if (i < a.m_numberOfVariables && a.m_variables[i] == b.m_variables[j]) {
+        i++;
+      }
+      variables[numberOfVariables++] = b.m_variables[j++];
+    }
+  }
+  assert(numberOfVariables <= k_maxNumberOfVariables);
+  *unifiedA = WithVariables(a, variables, numberOfVariables);
+  *unifiedB = WithVariables(b, variables, numberOfVariables);
+}
+
+Polynomial Polynomial::WithVariables(const Polynomial & p, const char * variables, int numberOfVariables) {
+  Polynomial result = p;
+  memcpy(result.m_variables, variables, numberOfVariables);
+  result.m_numberOfVariables = numberOfVariables;
+  if (p.m_numberOfVariables == numberOfVariables) {
+    return result;
+  }
+  /* p's variables are a sorted subset of the new ones: inserting zero
+   * exponents does not change the order of the terms. */
+  for (int i = 0; i < p.m_numberOfTerms; i++) {
+    memset(result.m_terms[i].exponents, 0, sizeof(result.m_terms[i].exponents));
+    for (int j = 0; j < p.m_numberOfVariables; j++) {
+      result.m_terms[i].exponents[result.variableIndex(p.m_variables[j])] = p.m_terms[i].exponents[j];
+    }
+  }
+  return result;
+}
+
+int Polynomial::CompareExponents(const Term & t1, const Term & t2, int numberOfVariables) {
+  for (int i = 0; i < numberOfVariables; i++) {
+    if (t1.exponents[i] != t2.exponents[i]) {
+      return t1.exponents[i] < t2.exponents[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+void Polynomial::MultiplyCoefficients(const Term & t1, const Term & t2, Term * result) {
+  Rational r = Rational::Multiplication(Rational(t1.numerator, t1.denominator), Rational(t2.numerator, t2.denominator));
+  result->numerator = r.numerator();
+  result->denominator = r.denominator();
+}
+
+void Polynomial::AddCoefficients(const Term & t1, const Term & t2, Term * result) {
+  Rational r = Rational::Addition(Rational(t1.numerator, t1.denominator), Rational(t2.numerator, t2.denominator));
+  result->numerator = r.numerator();
+  result->denominator = r.denominator();
+  memcpy(result->exponents, t1.exponents, sizeof(result->exponents));
+}
+
+Polynomial Polynomial::MultiplicationByTerm(const Polynomial & p, const Term & t) {
+  Polynomial result;
+  result.copyVariables(p);
+  if (t.numerator.isZero()) {
+    return result;
+  }
+  result.allocateTerms(p.m_numberOfTerms);
+  for (int i = 0; i < p.m_numberOfTerms; i++) {
+    MultiplyCoefficients(p.m_terms[i], t, &result.m_terms[i]);
+    for (int j = 0; j < p.m_numberOfVariables; j++) {
+      int e = p.m_terms[i].exponents[j] + t.exponents[j];
+      assert(e <= k_maxDegree);
+      result.m_terms[i].exponents[j] = e;
+    }
+  }
+  return result;
+}
+
+}
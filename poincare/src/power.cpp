@@ -5,17 +5,22 @@
 #include <poincare/binomial_coefficient.h>
 #include <poincare/cosine.h>
 #include <poincare/division.h>
+#include <poincare/linear_algebra.h>
 #include <poincare/matrix.h>
 #include <poincare/matrix_inverse.h>
 #include <poincare/nth_root.h>
 #include <poincare/opposite.h>
 #include <poincare/parenthesis.h>
+#include <poincare/polynomial.h>
 #include <poincare/simplification_root.h>
 #include <poincare/sine.h>
 #include <poincare/square_root.h>
 #include <poincare/symbol.h>
 #include <poincare/subtraction.h>
 #include <poincare/undefined.h>
+#include <poincare/rational.h>
+#include <poincare/multiplication.h>
+#include <poincare/naperian_logarithm.h>
 
 #include "layout/horizontal_layout.h"
 #include "layout/vertical_offset_layout.h"
@@ -117,6 +122,40 @@ Expression * Power::setSign(Sign s, Context & context, AngleUnit angleUnit) {
   return this;
 }
 
+RealInterval Power::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  return RealInterval::Power(operand(0)->privateApproximateInterval(symbol, x, context, angleUnit), operand(1)->privateApproximateInterval(symbol, x, context, angleUnit));
+}
+
+DualNumber Power::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber base = operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  DualNumber exponent = operand(1)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  // A kink of the base is carried through a constant exponent by the chain rule
+  bool isBaseDifferentiable = base.isDifferentiable() || (base.isSingular() && exponent.isConstant());
+  if (!isBaseDifferentiable || !exponent.isDifferentiable()) {
+    return DualNumber::Undifferentiable();
+  }
+  std::complex<double> value = compute<double>(base.value(), exponent.value());
+  if (base.isConstant() && exponent.isConstant()) {
+    return DualNumber::Constant(value);
+  }
+  if (exponent.isConstant()) {
+    if (exponent.value() == std::complex<double>(1.0)) {
+      return DualNumber(value, base.derivative());
+    }
+    // x^n is not differentiable on 0 when n < 1
+    if (base.value() == std::complex<double>(0.0) && exponent.value().real() < 1.0) {
+      return DualNumber::Undifferentiable();
+    }
+    // (a^n)' = n*a^(n-1)*a'
+    return DualNumber::Composition(base, value, exponent.value()*compute<double>(base.value(), exponent.value() - 1.0));
+  }
+  if (base.value() == std::complex<double>(0.0)) {
+    return DualNumber::Undifferentiable();
+  }
+  // (a^b)' = a^b*(b'*ln(a)+b*a'/a)
+  return DualNumber(value, value*(exponent.derivative()*std::log(base.value()) + exponent.value()*base.derivative()/base.value()));
+}
+
 template<typename T>
 std::complex<T> Power::compute(const std::complex<T> c, const std::complex<T> d) {
   /* Openbsd trigonometric functions are numerical implementation and thus are
@@ -129,11 +168,11 @@ std::complex<T> Power::compute(const std::complex<T> c, const std::complex<T> d)
   return ApproximationEngine::truncateRealOrImaginaryPartAccordingToArgument(result);
 }
 
-template<typename T> MatrixComplex<T> Power::computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> n) {
+template<typename T> MatrixComplex<T> Power::computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> & n) {
   return MatrixComplex<T>::Undefined();
 }
 
-template<typename T> MatrixComplex<T> Power::computeOnMatrixAndComplex(const MatrixComplex<T> m, const std::complex<T> d) {
+template<typename T> MatrixComplex<T> Power::computeOnMatrixAndComplex(const MatrixComplex<T> & m, const std::complex<T> d) {
  if (m.numberOfRows() != m.numberOfColumns()) {
     return MatrixComplex<T>::Undefined();
   }
@@ -151,18 +190,15 @@ template<typename T> MatrixComplex<T> Power::computeOnMatrixAndComplex(const Mat
     delete inverse;
     return result;
   }
-  MatrixComplex<T> result = MatrixComplex<T>::createIdentity(m.numberOfRows());
-  // TODO: implement a quick exponentiation
-  for (int k = 0; k < (int)power; k++) {
-    if (shouldStopProcessing()) {
-      return MatrixComplex<T>::Undefined();
-    }
-    result = Multiplication::computeOnMatrices<T>(result, m);
-  }
+  int dim = m.numberOfRows();
+  std::complex<T> * operands = new std::complex<T> [dim*dim];
+  LinearAlgebra::Power(m.complexOperands(), dim, (int)power, operands);
+  MatrixComplex<T> result = MatrixComplex<T>(operands, dim, dim);
+  delete[] operands;
   return result;
 }
 
-template<typename T> MatrixComplex<T> Power::computeOnMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n) {
+template<typename T> MatrixComplex<T> Power::computeOnMatrices(const MatrixComplex<T> & m, const MatrixComplex<T> & n) {
   return MatrixComplex<T>::Undefined();
 }
 
@@ -433,26 +469,36 @@ Expression * Power::shallowReduce(Context& context, AngleUnit angleUnit) {
     }
   }
 
+  /* (a0+a1+...am)^n with n integer and ai polynomials: the expansion is
+   * computed on the Polynomial type, which is much faster than distributing
+   * and reducing intermediate sums. */
+  if (!letPowerAtRoot && operand(1)->type() == Type::Rational && static_cast<const Rational *>(operand(1))->denominator().isOne() && operand(0)->type() == Type::Addition) {
+    Rational * nr = static_cast<Rational *>(editableOperand(1));
+    Integer n = nr->numerator();
+    n.setNegative(false);
+    Polynomial base;
+    if (!n.isOne() && MultinomeCanBeExpanded(operand(0)->numberOfOperands(), n) && Polynomial::FromExpression(operand(0), &base) && Polynomial::CanPower(base, n.extractedInt())) {
+      Expression * result = Polynomial::Power(base, n.extractedInt()).createExpression();
+      if (nr->sign() == Sign::Negative) {
+        editableOperand(0)->replaceWith(result, true);
+        result->deepReduce(context, angleUnit);
+        nr->replaceWith(new Rational(-1), true);
+        return shallowReduce(context, angleUnit);
+      }
+      return replaceWith(result, true)->deepReduce(context, angleUnit);
+    }
+  }
+
   // (a0+a1+...am)^n with n integer -> a^n+?a^(n-1)*b+?a^(n-2)*b^2+...+b^n (Multinome)
   if (!letPowerAtRoot && operand(1)->type() == Type::Rational && static_cast<const Rational *>(operand(1))->denominator().isOne() && operand(0)->type() == Type::Addition) {
     // Exponent n
     Rational * nr = static_cast<Rational *>(editableOperand(1));
     Integer n = nr->numerator();
     n.setNegative(false);
-    /* if n is above 25, the resulting sum would have more than
-     * k_maxNumberOfTermsInExpandedMultinome terms so we do not expand it. */
-    if (Integer(k_maxNumberOfTermsInExpandedMultinome).isLowerThan(n) || n.isOne()) {
+    if (n.isOne() || !MultinomeCanBeExpanded(operand(0)->numberOfOperands(), n)) {
       return this;
     }
     int clippedN = n.extractedInt(); // Authorized because n < k_maxNumberOfTermsInExpandedMultinome
-    // Number of terms in addition m
-    int m = operand(0)->numberOfOperands();
-    /* The multinome (a0+a2+...+a(m-1))^n has BinomialCoefficient(n+m-1,n) terms;
-     * we expand the multinome only when the number of terms in the resulting
-     * sum has less than k_maxNumberOfTermsInExpandedMultinome terms. */
-    if (k_maxNumberOfTermsInExpandedMultinome < BinomialCoefficient::compute(static_cast<double>(clippedN), static_cast<double>(clippedN+m-1))) {
-      return this;
-    }
     Expression * result = editableOperand(0);
     Expression * a = result->clone();
     for (int i = 2; i <= clippedN; i++) {
@@ -527,6 +573,38 @@ Expression * Power::shallowReduce(Context& context, AngleUnit angleUnit) {
   return this;
 }
 
+Expression * Power::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * baseDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (baseDerivative == nullptr) {
+    return nullptr;
+  }
+  if (operand(1)->polynomialDegree(symbol) == 0) {
+    // (u^n)' = n*u^(n-1)*u'
+    Power * power = new Power(operand(0)->clone(), new Subtraction(operand(1)->clone(), new Rational(1), false), false);
+    const Expression * multOperands[3] = {operand(1)->clone(), power, baseDerivative};
+    return new Multiplication(multOperands, 3, false);
+  }
+  Expression * exponentDerivative = operand(1)->createDerivative(symbol, angleUnit);
+  if (exponentDerivative == nullptr) {
+    delete baseDerivative;
+    return nullptr;
+  }
+  // (u^v)' = u^v*(v'*ln(u)+v*u'/u)
+  Multiplication * logarithmTerm = new Multiplication(exponentDerivative, new NaperianLogarithm(operand(0), true), false);
+  const Expression * quotientOperands[3] = {operand(1)->clone(), baseDerivative, new Power(operand(0)->clone(), new Rational(-1), false)};
+  Multiplication * quotientTerm = new Multiplication(quotientOperands, 3, false);
+  return new Multiplication(clone(), new Addition(logarithmTerm, quotientTerm, false), false);
+}
+
+bool Power::MultinomeCanBeExpanded(int numberOfTermsInBase, const Integer & n) {
+  // If n is above 25, the resulting sum would have more than 25 terms
+  if (Integer(k_maxNumberOfTermsInExpandedMultinome).isLowerThan(n)) {
+    return false;
+  }
+  int clippedN = n.extractedInt(); // Authorized because n < k_maxNumberOfTermsInExpandedMultinome
+  return BinomialCoefficient::compute(static_cast<double>(clippedN), static_cast<double>(clippedN+numberOfTermsInBase-1)) <= k_maxNumberOfTermsInExpandedMultinome;
+}
+
 bool Power::parentIsALogarithmOfSameBase() const {
   if (parent()->type() == Type::Logarithm && parent()->operand(0) == this) {
     // parent = log(10^x)
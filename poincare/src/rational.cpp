@@ -47,6 +47,7 @@ Rational & Rational::operator=(const Rational & other) {
   m_numerator = other.m_numerator;
   m_numerator = other.m_numerator;
   m_denominator = other.m_denominator;
+  invalidateHash();
   return *this;
 }
 
@@ -79,18 +80,24 @@ Expression * Rational::setSign(Sign s) {
   assert(s != Sign::Unknown);
   bool negative = s == Sign::Negative ? true : false;
   m_numerator.setNegative(negative);
+  invalidateHash();
   return this;
 }
 
 Expression * Rational::shallowBeautify(Context & context, AngleUnit angleUnit) {
   if (m_numerator.isNegative()) {
     m_numerator.setNegative(false);
+    invalidateHash();
     Opposite * o = new Opposite(this, true);
     return replaceWith(o, true);
   }
   return this;
 }
 
+Expression * Rational::createDerivative(char symbol, AngleUnit angleUnit) const {
+  return new Rational(0);
+}
+
 Expression * Rational::cloneDenominator(Context & context, AngleUnit angleUnit) const {
   if (m_denominator.isOne()) {
     return nullptr;
@@ -137,6 +144,13 @@ int Rational::simplificationOrderSameType(const Expression * e, bool canBeInterr
   return NaturalOrder(*this, *other);
 }
 
+uint32_t Rational::computeHash() const {
+  // Rationals are irreducible fractions: equal rationals have equal terms
+  uint32_t hash = CombineHash(0, (uint32_t)type());
+  hash = CombineHash(hash, m_numerator.hash());
+  return CombineHash(hash, m_denominator.hash());
+}
+
 template<typename T> Complex<T> * Rational::templatedApproximate(Context& context, Expression::AngleUnit angleUnit) const {
   T n = m_numerator.approximate<T>();
   T d = m_denominator.approximate<T>();
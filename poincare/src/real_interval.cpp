@@ -0,0 +1,205 @@
+#include <poincare/real_interval.h>
+#include <float.h>
+
+namespace Poincare {
+
+static inline double minDouble(double x, double y) { return x < y ? x : y; }
+static inline double maxDouble(double x, double y) { return x > y ? x : y; }
+
+RealInterval RealInterval::Union(RealInterval a, RealInterval b) {
+  if (a.isUndefined()) {
+    return b;
+  }
+  if (b.isUndefined()) {
+    return a;
+  }
+  return RealInterval(minDouble(a.m_lower, b.m_lower), maxDouble(a.m_upper, b.m_upper));
+}
+
+RealInterval RealInterval::Opposite(RealInterval a) {
+  return RealInterval(-a.m_upper, -a.m_lower);
+}
+
+RealInterval RealInterval::Addition(RealInterval a, RealInterval b) {
+  if (a.isUndefined() || b.isUndefined()) {
+    return Undefined();
+  }
+  return Outward(a.m_lower + b.m_lower, a.m_upper + b.m_upper);
+}
+
+RealInterval RealInterval::Subtraction(RealInterval a, RealInterval b) {
+  return Addition(a, Opposite(b));
+}
+
+RealInterval RealInterval::Multiplication(RealInterval a, RealInterval b) {
+  if (a.isUndefined() || b.isUndefined()) {
+    return Undefined();
+  }
+  double products[4] = {a.m_lower*b.m_lower, a.m_lower*b.m_upper, a.m_upper*b.m_lower, a.m_upper*b.m_upper};
+  double lower = products[0];
+  double upper = products[0];
+  for (int i = 1; i < 4; i++) {
+    if (std::isnan(products[i])) {
+      return Unbounded();
+    }
+    lower = minDouble(lower, products[i]);
+    upper = maxDouble(upper, products[i]);
+  }
+  return Outward(lower, upper);
+}
+
+RealInterval RealInterval::Division(RealInterval a, RealInterval b) {
+  if (a.isUndefined() || b.isUndefined()) {
+    return Undefined();
+  }
+  if (b.contains(0.0)) {
+    return Unbounded();
+  }
+  /* As 0 is not in b, 1/b is monotonic on b and a/b = a*(1/b). The rounding
+   * error of the inversion is absorbed by widening. */
+  return Multiplication(a, Outward(1.0/b.m_upper, 1.0/b.m_lower));
+}
+
+RealInterval RealInterval::IntegerPower(RealInterval a, int n) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  if (n == 0) {
+    return RealInterval(1.0, 1.0);
+  }
+  if (n < 0) {
+    return Division(RealInterval(1.0, 1.0), IntegerPower(a, -n));
+  }
+  // The square of a non-real number can be a negative real number
+  if (a.isUnbounded()) {
+    return Unbounded();
+  }
+  if (n % 2 == 1 || a.m_lower >= 0.0) {
+    // x -> x^n is increasing on a
+    return Outward(std::pow(a.m_lower, (double)n), std::pow(a.m_upper, (double)n));
+  }
+  if (a.m_upper <= 0.0) {
+    // x -> x^n is decreasing on a
+    return Outward(std::pow(a.m_upper, (double)n), std::pow(a.m_lower, (double)n));
+  }
+  return Outward(0.0, std::pow(maxDouble(-a.m_lower, a.m_upper), (double)n));
+}
+
+RealInterval RealInterval::Power(RealInterval a, RealInterval b) {
+  if (a.isUndefined() || b.isUndefined()) {
+    return Undefined();
+  }
+  if (b.isPoint() && std::fabs(b.m_lower) <= k_maxIntegerPower && b.m_lower == std::round(b.m_lower)) {
+    return IntegerPower(a, (int)b.m_lower);
+  }
+  /* A negative number to a non-integer power is not real, and 0 to a
+   * negative power is not defined. */
+  if (a.m_lower < 0.0 || (a.m_lower == 0.0 && b.m_lower < 0.0)) {
+    return Unbounded();
+  }
+  // 0^y is approximated to 0
+  RealInterval result = a.m_lower == 0.0 ? RealInterval(0.0, 0.0) : Undefined();
+  if (a.m_upper > 0.0) {
+    RealInterval positiveBase(maxDouble(a.m_lower, DBL_MIN), a.m_upper);
+    result = Union(result, Exponential(Multiplication(b, NaperianLogarithm(positiveBase))));
+  }
+  return result;
+}
+
+RealInterval RealInterval::AbsoluteValue(RealInterval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  if (a.m_lower >= 0.0) {
+    return a;
+  }
+  if (a.m_upper <= 0.0) {
+    return Opposite(a);
+  }
+  return RealInterval(0.0, maxDouble(-a.m_lower, a.m_upper));
+}
+
+RealInterval RealInterval::SquareRoot(RealInterval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  // The square root of a negative number is not real
+  if (a.m_lower < 0.0) {
+    return Unbounded();
+  }
+  return Outward(std::sqrt(a.m_lower), std::sqrt(a.m_upper));
+}
+
+RealInterval RealInterval::Exponential(RealInterval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  // exp(i*Pi) = -1
+  if (a.isUnbounded()) {
+    return Unbounded();
+  }
+  return Outward(std::exp(a.m_lower), std::exp(a.m_upper));
+}
+
+RealInterval RealInterval::NaperianLogarithm(RealInterval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  // The logarithm of a negative number is not real
+  if (a.m_lower < 0.0) {
+    return Unbounded();
+  }
+  return Outward(std::log(a.m_lower), std::log(a.m_upper));
+}
+
+RealInterval RealInterval::Cosine(RealInterval a) {
+  if (a.isUndefined()) {
+    return Undefined();
+  }
+  // cos(i*x) = cosh(x) is greater than 1
+  if (a.isUnbounded()) {
+    return Unbounded();
+  }
+  /* Beyond 1E15, consecutive floating-point numbers are too far apart to
+   * locate the extrema of the cosine. */
+  if (a.m_upper - a.m_lower >= 2.0*M_PI || std::fabs(a.m_lower) > 1E15 || std::fabs(a.m_upper) > 1E15) {
+    return RealInterval(-1.0, 1.0);
+  }
+  double lower = minDouble(std::cos(a.m_lower), std::cos(a.m_upper));
+  double upper = maxDouble(std::cos(a.m_lower), std::cos(a.m_upper));
+  // The cosine reaches 1 on 2k*Pi and -1 on (2k+1)*Pi
+  double k = std::ceil(a.m_lower/M_PI);
+  for (double extremum = k*M_PI; extremum <= a.m_upper; extremum += M_PI) {
+    if (std::fmod(k, 2.0) == 0.0) {
+      upper = 1.0;
+    } else {
+      lower = -1.0;
+    }
+    k += 1.0;
+  }
+  /* The approximation of cosine keeps 15 decimals only, which adds an
+   * absolute error of 1E-14. */
+  RealInterval result = Outward(lower, upper);
+  return RealInterval(result.m_lower - 1E-14, result.m_upper + 1E-14);
+}
+
+RealInterval RealInterval::Sine(RealInterval a) {
+  // sin(x) = cos(x-Pi/2)
+  return Cosine(Subtraction(a, Approximate(M_PI/2.0)));
+}
+
+RealInterval RealInterval::Outward(double lower, double upper) {
+  if (std::isnan(lower) || std::isnan(upper)) {
+    return Unbounded();
+  }
+  // Zero bounds are kept as rounding preserves signs
+  if (lower != 0.0 && !std::isinf(lower)) {
+    lower = lower - std::fabs(lower)*k_relativeError - DBL_MIN;
+  }
+  if (upper != 0.0 && !std::isinf(upper)) {
+    upper = upper + std::fabs(upper)*k_relativeError + DBL_MIN;
+  }
+  return RealInterval(lower, upper);
+}
+
+}
@@ -0,0 +1,120 @@
+#include <poincare/simplification_cache.h>
+#include <poincare/symbol.h>
+#include <string.h>
+#include <assert.h>
+
+namespace Poincare {
+
+SimplificationCache::SimplificationCache() :
+  m_clock(0)
+{
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    m_entries[i].expression = nullptr;
+    resetEntry(&m_entries[i]);
+  }
+}
+
+SimplificationCache::~SimplificationCache() {
+  reset();
+}
+
+Expression * SimplificationCache::simplifiedExpression(const char * text, Expression::AngleUnit angleUnit) {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    Entry * entry = &m_entries[i];
+    if (entry->expression != nullptr && entry->angleUnit == angleUnit && strcmp(entry->text, text) == 0) {
+      entry->lastUse = ++m_clock;
+      return entry->expression->clone();
+    }
+  }
+  return nullptr;
+}
+
+void SimplificationCache::store(const char * text, Expression::AngleUnit angleUnit, const Expression * expression, const Expression * simplifiedExpression) {
+  assert(CanStore(text, expression));
+  // Replace the least recently used entry, empty entries being the first ones
+  Entry * entry = &m_entries[0];
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    if (m_entries[i].expression == nullptr) {
+      entry = &m_entries[i];
+      break;
+    }
+    if (m_entries[i].lastUse < entry->lastUse) {
+      entry = &m_entries[i];
+    }
+  }
+  resetEntry(entry);
+  strlcpy(entry->text, text, k_maxTextLength);
+  entry->angleUnit = angleUnit;
+  entry->expression = simplifiedExpression->clone();
+  entry->dependencies = Dependencies(expression);
+  entry->lastUse = ++m_clock;
+}
+
+bool SimplificationCache::CanStore(const char * text, const Expression * expression) {
+  /* The simplification of a store modifies the context: it cannot be skipped
+   * by the cache. */
+  return strlen(text) < k_maxTextLength && !ContainsStore(expression);
+}
+
+void SimplificationCache::invalidateSymbol(const Symbol * symbol) {
+  uint64_t mask = SymbolMask(symbol);
+  if (mask == 0) {
+    return;
+  }
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    if (m_entries[i].dependencies & mask) {
+      resetEntry(&m_entries[i]);
+    }
+  }
+}
+
+void SimplificationCache::reset() {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    resetEntry(&m_entries[i]);
+  }
+}
+
+uint64_t SimplificationCache::SymbolMask(const Symbol * symbol) {
+  if (symbol->isScalarSymbol()) {
+    return (uint64_t)1 << (symbol->name() - 'A');
+  }
+  if (symbol->isMatrixSymbol()) {
+    return (uint64_t)1 << ('Z' - 'A' + 1 + symbol->name() - (char)Symbol::SpecialSymbols::M0);
+  }
+  return 0;
+}
+
+uint64_t SimplificationCache::Dependencies(const Expression * expression) {
+  if (expression->type() == Expression::Type::Symbol) {
+    return SymbolMask(static_cast<const Symbol *>(expression));
+  }
+  uint64_t dependencies = 0;
+  for (int i = 0; i < expression->numberOfOperands(); i++) {
+    dependencies |= Dependencies(expression->operand(i));
+  }
+  return dependencies;
+}
+
+bool SimplificationCache::ContainsStore(const Expression * expression) {
+  if (expression->type() == Expression::Type::Store) {
+    return true;
+  }
+  for (int i = 0; i < expression->numberOfOperands(); i++) {
+    if (ContainsStore(expression->operand(i))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void SimplificationCache::resetEntry(Entry * entry) {
+  if (entry->expression != nullptr) {
+    delete entry->expression;
+    entry->expression = nullptr;
+  }
+  entry->text[0] = 0;
+  entry->dependencies = 0;
+  entry->lastUse = 0;
+}
+
+}
@@ -4,6 +4,7 @@
 #include <poincare/multiplication.h>
 #include <poincare/symbol.h>
 #include <poincare/simplification_engine.h>
+#include <poincare/cosine.h>
 #include <ion.h>
 extern "C" {
 #include <assert.h>
@@ -25,6 +26,16 @@ float Sine::characteristicXRange(Context & context, AngleUnit angleUnit) const {
   return Trigonometry::characteristicXRange(this, context, angleUnit);
 }
 
+RealInterval Sine::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  RealInterval angle = operand(0)->privateApproximateInterval(symbol, x, context, angleUnit);
+  return RealInterval::Sine(Trigonometry::ConvertToRadian(angle, angleUnit));
+}
+
+DualNumber Sine::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber angle = Trigonometry::ConvertToRadian(operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit), angleUnit);
+  return DualNumber::Composition(angle, computeOnComplex<double>(angle.value()), std::cos(angle.value()));
+}
+
 template<typename T>
 std::complex<T> Sine::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> angleInput = Trigonometry::ConvertToRadian(c, angleUnit);
@@ -46,4 +57,13 @@ Expression * Sine::shallowReduce(Context& context, AngleUnit angleUnit) {
   return Trigonometry::shallowReduceDirectFunction(this, context, angleUnit);
 }
 
+Expression * Sine::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * angleDerivative = Trigonometry::CreateRadianAngleDerivative(operand(0), symbol, angleUnit);
+  if (angleDerivative == nullptr) {
+    return nullptr;
+  }
+  // sin(u)' = cos(u)*u'
+  return new Multiplication(new Cosine(operand(0), true), angleDerivative, false);
+}
+
 }
@@ -1,6 +1,8 @@
 #include <poincare/square_root.h>
 #include <poincare/power.h>
 #include <poincare/simplification_engine.h>
+#include <poincare/rational.h>
+#include <poincare/multiplication.h>
 #include "layout/nth_root_layout.h"
 extern "C" {
 #include <assert.h>
@@ -24,6 +26,16 @@ int SquareRoot::writeTextInBuffer(char * buffer, int bufferSize, PrintFloat::Mod
   return LayoutEngine::writePrefixExpressionTextInBuffer(this, buffer, bufferSize, floatDisplayMode, numberOfSignificantDigits, "\x91");
 }
 
+RealInterval SquareRoot::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  return RealInterval::SquareRoot(operand(0)->privateApproximateInterval(symbol, x, context, angleUnit));
+}
+
+DualNumber SquareRoot::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber a = operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit);
+  std::complex<double> value = computeOnComplex<double>(a.value(), angleUnit);
+  return DualNumber::Composition(a, value, 0.5/value);
+}
+
 template<typename T>
 std::complex<T> SquareRoot::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> result = std::sqrt(c);
@@ -52,6 +64,16 @@ Expression * SquareRoot::shallowReduce(Context& context, AngleUnit angleUnit) {
   return p->shallowReduce(context, angleUnit);
 }
 
+Expression * SquareRoot::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * operandDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  if (operandDerivative == nullptr) {
+    return nullptr;
+  }
+  // sqrt(u)' = u'/(2*sqrt(u))
+  const Expression * multOperands[3] = {new Rational(1, 2), new Power(operand(0), new Rational(-1, 2), true), operandDerivative};
+  return new Multiplication(multOperands, 3, false);
+}
+
 ExpressionLayout * SquareRoot::createLayout(PrintFloat::Mode floatDisplayMode, int numberOfSignificantDigits) const {
   return new NthRootLayout(operand(0)->createLayout(floatDisplayMode, numberOfSignificantDigits), false);
 }
@@ -64,6 +64,7 @@ void StaticHierarchy<T>::build(const Expression * const * operands, int numberOf
     }
     const_cast<Expression *>(m_operands[i])->setParent(this);
   }
+  this->invalidateHash();
 }
 
 template<int T>
@@ -84,6 +85,15 @@ int StaticHierarchy<T>::simplificationOrderSameType(const Expression * e, bool c
   return 0;
 }
 
+template<int T>
+uint32_t StaticHierarchy<T>::computeHash() const {
+  uint32_t hash = CombineHash(0, (uint32_t)this->type());
+  for (int i = 0; i < this->numberOfOperands(); i++) {
+    hash = CombineHash(hash, m_operands[i]->hash());
+  }
+  return hash;
+}
+
 template class Poincare::StaticHierarchy<0>;
 template class Poincare::StaticHierarchy<1>;
 template class Poincare::StaticHierarchy<2>;
@@ -38,12 +38,20 @@ bool Subtraction::needParenthesisWithParent(const Expression * e) const {
   return e->isOfType(types, 6);
 }
 
+RealInterval Subtraction::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  return RealInterval::Subtraction(operand(0)->privateApproximateInterval(symbol, x, context, angleUnit), operand(1)->privateApproximateInterval(symbol, x, context, angleUnit));
+}
+
+DualNumber Subtraction::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  return DualNumber::Subtraction(operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit), operand(1)->privateApproximateWithDerivative(symbol, x, context, angleUnit));
+}
+
 template<typename T>
 std::complex<T> Subtraction::compute(const std::complex<T> c, const std::complex<T> d) {
   return c - d;
 }
 
-template<typename T> MatrixComplex<T> Subtraction::computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> m) {
+template<typename T> MatrixComplex<T> Subtraction::computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> & m) {
   MatrixComplex<T> opposite = computeOnMatrixAndComplex(m, c);
   std::complex<T> * operands = new std::complex<T> [opposite.numberOfComplexOperands()];
   for (int i = 0; i < opposite.numberOfComplexOperands(); i++) {
@@ -67,4 +75,16 @@ Expression * Subtraction::shallowReduce(Context& context, AngleUnit angleUnit) {
   return a->shallowReduce(context, angleUnit);
 }
 
+Expression * Subtraction::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * firstDerivative = operand(0)->createDerivative(symbol, angleUnit);
+  Expression * secondDerivative = operand(1)->createDerivative(symbol, angleUnit);
+  if (firstDerivative == nullptr || secondDerivative == nullptr) {
+    delete firstDerivative;
+    delete secondDerivative;
+    return nullptr;
+  }
+  // (u-v)' = u'-v'
+  return new Subtraction(firstDerivative, secondDerivative, false);
+}
+
 }
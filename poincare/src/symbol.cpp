@@ -7,6 +7,7 @@
 #include <poincare/power.h>
 
 #include <poincare/layout_engine.h>
+#include <poincare/rational.h>
 #include "layout/char_layout.h"
 #include "layout/horizontal_layout.h"
 #include "layout/vertical_offset_layout.h"
@@ -224,6 +225,27 @@ Expression * Symbol::shallowReduce(Context& context, AngleUnit angleUnit) {
   return this;
 }
 
+Expression * Symbol::createDerivative(char symbol, AngleUnit angleUnit) const {
+  if (isMatrixSymbol()) {
+    return nullptr;
+  }
+  return new Rational(m_name == symbol ? 1 : 0);
+}
+
+RealInterval Symbol::privateApproximateInterval(char symbol, RealInterval x, Context & context, AngleUnit angleUnit) const {
+  if (m_name == symbol) {
+    return x;
+  }
+  return Expression::privateApproximateInterval(symbol, x, context, angleUnit);
+}
+
+DualNumber Symbol::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  if (m_name == symbol) {
+    return x;
+  }
+  return Expression::privateApproximateWithDerivative(symbol, x, context, angleUnit);
+}
+
 template<typename T>
 Evaluation<T> * Symbol::templatedApproximate(Context& context, AngleUnit angleUnit) const {
   if (m_name == Ion::Charset::IComplex) {
@@ -352,4 +374,8 @@ int Symbol::simplificationOrderSameType(const Expression * e, bool canBeInterrup
   return -1;
 }
 
+uint32_t Symbol::computeHash() const {
+  return CombineHash(CombineHash(0, (uint32_t)type()), (uint8_t)m_name);
+}
+
 }
@@ -6,6 +6,8 @@
 #include <poincare/trigonometry.h>
 #include <poincare/hyperbolic_tangent.h>
 #include <poincare/simplification_engine.h>
+#include <poincare/rational.h>
+#include <poincare/power.h>
 extern "C" {
 #include <assert.h>
 }
@@ -26,6 +28,12 @@ float Tangent::characteristicXRange(Context & context, AngleUnit angleUnit) cons
   return Trigonometry::characteristicXRange(this, context, angleUnit);
 }
 
+DualNumber Tangent::privateApproximateWithDerivative(char symbol, DualNumber x, Context & context, AngleUnit angleUnit) const {
+  DualNumber angle = Trigonometry::ConvertToRadian(operand(0)->privateApproximateWithDerivative(symbol, x, context, angleUnit), angleUnit);
+  std::complex<double> cosine = std::cos(angle.value());
+  return DualNumber::Composition(angle, computeOnComplex<double>(angle.value()), 1.0/(cosine*cosine));
+}
+
 template<typename T>
 std::complex<T> Tangent::computeOnComplex(const std::complex<T> c, AngleUnit angleUnit) {
   std::complex<T> angleInput = Trigonometry::ConvertToRadian(c, angleUnit);
@@ -56,4 +64,14 @@ Expression * Tangent::shallowReduce(Context& context, AngleUnit angleUnit) {
   return newExpression;
 }
 
+Expression * Tangent::createDerivative(char symbol, AngleUnit angleUnit) const {
+  Expression * angleDerivative = Trigonometry::CreateRadianAngleDerivative(operand(0), symbol, angleUnit);
+  if (angleDerivative == nullptr) {
+    return nullptr;
+  }
+  // tan(u)' = u'/cos(u)^2
+  Power * inverseSquaredCosine = new Power(new Cosine(operand(0), true), new Rational(-2), false);
+  return new Multiplication(inverseSquaredCosine, angleDerivative, false);
+}
+
 }
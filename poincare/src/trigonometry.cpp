@@ -5,6 +5,7 @@
 #include <poincare/undefined.h>
 #include <poincare/rational.h>
 #include <poincare/multiplication.h>
+#include <poincare/power.h>
 #include <poincare/subtraction.h>
 #include <poincare/derivative.h>
 #include <poincare/decimal.h>
@@ -238,6 +239,38 @@ std::complex<T> Trigonometry::ConvertToRadian(const std::complex<T> c, Expressio
   return c;
 }
 
+RealInterval Trigonometry::ConvertToRadian(RealInterval c, Expression::AngleUnit angleUnit) {
+  if (angleUnit == Expression::AngleUnit::Degree) {
+    // The factor is the exact double used by the scalar conversion
+    return RealInterval::Multiplication(c, RealInterval(M_PI/180.0, M_PI/180.0));
+  }
+  return c;
+}
+
+DualNumber Trigonometry::ConvertToRadian(DualNumber c, Expression::AngleUnit angleUnit) {
+  if (angleUnit == Expression::AngleUnit::Degree) {
+    return DualNumber::Multiplication(c, DualNumber::Constant(M_PI/180.0));
+  }
+  return c;
+}
+
+Expression * Trigonometry::CreateRadianAngleDerivative(const Expression * angle, char symbol, Expression::AngleUnit angleUnit) {
+  Expression * derivative = angle->createDerivative(symbol, angleUnit);
+  if (derivative == nullptr || angleUnit == Expression::AngleUnit::Radian) {
+    return derivative;
+  }
+  const Expression * multOperands[3] = {derivative, new Symbol(Ion::Charset::SmallPi), new Rational(1, 180)};
+  return new Multiplication(multOperands, 3, false);
+}
+
+Expression * Trigonometry::ConvertRadianDerivativeToAngleUnit(Expression * derivative, Expression::AngleUnit angleUnit) {
+  if (angleUnit == Expression::AngleUnit::Radian) {
+    return derivative;
+  }
+  const Expression * multOperands[3] = {derivative, new Power(new Symbol(Ion::Charset::SmallPi), new Rational(-1), false), new Rational(180)};
+  return new Multiplication(multOperands, 3, false);
+}
+
 template <typename T>
 std::complex<T> Trigonometry::ConvertRadianToAngleUnit(const std::complex<T> c, Expression::AngleUnit angleUnit) {
   if (angleUnit == Expression::AngleUnit::Degree) {
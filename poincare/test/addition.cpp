@@ -46,3 +46,32 @@ QUIZ_CASE(poincare_addition_simplify) {
   assert_parsed_expression_simplify_to("A+B+(-1)*A+(-1)*B", "0");
   assert_parsed_expression_simplify_to("3^(1/2)+2^(-2*3^(1/2)*X^P)/2", "(1+2*2^(2*R(3)*X^P)*R(3))/(2*2^(2*R(3)*X^P))");
 }
+
+static void assert_sum_of_powers_is_sorted(int numberOfTerms) {
+  // x^2+x^3+...+x^(n+1) with the terms in a scrambled order
+  constexpr int bufferSize = 1200;
+  char buffer[bufferSize];
+  int length = 0;
+  for (int k = 0; k < numberOfTerms; k++) {
+    length += strlcpy(buffer+length, k == 0 ? "x^" : "+x^", bufferSize-length);
+    length += Integer((37*k)%numberOfTerms+2).writeTextInBuffer(buffer+length, bufferSize-length);
+  }
+  assert(length < bufferSize-1);
+  GlobalContext globalContext;
+  Expression * e = Expression::parse(buffer);
+  assert(e != nullptr);
+  Expression::Simplify(&e, globalContext, Radian);
+  assert(e->type() == Expression::Type::Addition);
+  assert(e->numberOfOperands() == numberOfTerms);
+  for (int k = 0; k < numberOfTerms; k++) {
+    // The terms are sorted by increasing degree
+    assert(e->operand(k)->polynomialDegree('x') == k+2);
+  }
+  delete e;
+}
+
+QUIZ_CASE(poincare_addition_sort_many_terms) {
+  assert_sum_of_powers_is_sorted(50);
+  assert_sum_of_powers_is_sorted(100);
+  assert_sum_of_powers_is_sorted(200);
+}
@@ -2,7 +2,9 @@
 #include <poincare.h>
 #include <poincare/arithmetic.h>
 #include <assert.h>
+#include <string.h>
 #include <utility>
+#include "helper.h"
 
 #if POINCARE_TESTS_PRINT_EXPRESSIONS
 #include "../src/expression_debug.h"
@@ -68,6 +70,14 @@ QUIZ_CASE(poincare_arithmetic) {
   assert_gcd_equals_to(Integer(-8), Integer(-40), Integer(8));
   assert_gcd_equals_to(Integer("1234567899876543456", true), Integer("234567890098765445678"), Integer(2));
   assert_gcd_equals_to(Integer("45678998789"), Integer("1461727961248"), Integer("45678998789"));
+  assert_gcd_equals_to(Integer(0), Integer("-1461727961248"), Integer("1461727961248"));
+  assert_gcd_equals_to(Integer("18446744073709551616"), Integer("4294967296"), Integer("4294967296"));
+  assert_gcd_equals_to(Integer("79228162514264337593543950335"), Integer("18446744073709551615"), Integer("4294967295"));
+  assert_gcd_equals_to(Integer("2305843009213693951", true), Integer("618970019642690137449562111"), Integer(1));
+  // Operands with many digits
+  assert_gcd_equals_to(Integer("265252859812191058636308480000000"), Integer("815915283247897734345611269596115894272000000000"), Integer("265252859812191058636308480000000"));
+  assert_gcd_equals_to(Integer("1307674368000007412943219086745012930467"), Integer("87178291200000121645100408832000000217"), Integer(7));
+  assert_gcd_equals_to(Integer::Multiplication(Integer::Power(Integer(3), Integer(200)), Integer::Power(Integer(2), Integer(150))), Integer::Multiplication(Integer::Power(Integer(3), Integer(150)), Integer::Power(Integer(10), Integer(100))), Integer::Multiplication(Integer::Power(Integer(3), Integer(150)), Integer::Power(Integer(2), Integer(100))));
   assert_lcm_equals_to(Integer(11), Integer(121), Integer(121));
   assert_lcm_equals_to(Integer(-31), Integer(52), Integer(1612));
   assert_lcm_equals_to(Integer(-8), Integer(-40), Integer(40));
@@ -85,4 +95,67 @@ QUIZ_CASE(poincare_arithmetic) {
   int factors3[7] = {3,7,11, 13, 19, 3607, 3803};
   int coefficients3[7] = {4,2,2,2,2,2,2};
   assert_prime_factorization_equals_to(Integer("5513219850886344455940081"), factors3, coefficients3, 7);
+  int factors4[2] = {10007, 1000003};
+  int coefficients4[2] = {3, 2};
+  assert_prime_factorization_equals_to(Integer("1002107482960840971233087"), factors4, coefficients4, 2);
+}
+
+void assert_semiprime_factorization_equals_to(const char * n, const char * p, const char * q) {
+  Integer i(n);
+  Integer outputFactors[Arithmetic::k_maxNumberOfPrimeFactors];
+  Integer outputCoefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  Arithmetic::PrimeFactorization(&i, outputFactors, outputCoefficients, Arithmetic::k_maxNumberOfPrimeFactors);
+  assert(outputFactors[0].isEqualTo(Integer(p)) && outputCoefficients[0].isOne());
+  assert(outputFactors[1].isEqualTo(Integer(q)) && outputCoefficients[1].isOne());
+  assert(outputCoefficients[2].isZero());
+}
+
+QUIZ_CASE(poincare_arithmetic_semiprime_factorization) {
+  assert_semiprime_factorization_equals_to("28962645732620633153", "4889989547", "5922844099");
+  assert_semiprime_factorization_equals_to("29535408076105332913", "4969952167", "5942795239");
+  assert_semiprime_factorization_equals_to("1127011100172605196362956188587941", "1068623261", "1054638375659132499795881");
+}
+
+static void assert_factorization_gives_up(const char * n) {
+  Integer i(n);
+  Integer outputFactors[Arithmetic::k_maxNumberOfPrimeFactors];
+  Integer outputCoefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  Arithmetic::PrimeFactorization(&i, outputFactors, outputCoefficients, Arithmetic::k_maxNumberOfPrimeFactors);
+  assert(outputCoefficients[0].isEqualTo(Integer(-1)));
+}
+
+QUIZ_CASE(poincare_arithmetic_factorization_gives_up) {
+  // 3*(2^89-1): 2^89-1 is prime but above the deterministic Miller-Rabin bound
+  assert_factorization_gives_up("1856910058928070412348686333");
+  // The product of two 21-digit primes takes too long to split
+  assert_factorization_gives_up("10000000000000000016800000000000000005031");
+}
+
+QUIZ_CASE(poincare_arithmetic_fraction_sum) {
+  // 1/1+1/2+...+1/200 = numerator/denominator
+  Integer numerator("73430450139366304745412892037069099001170161275640475032430988199840965762047744114895233");
+  Integer denominator("12492355141960232023683917288697829904903495658709527193661000811749408076321384817296000");
+  Rational sum(0);
+  for (int k = 1; k <= 200; k++) {
+    sum = Rational::Addition(sum, Rational(Integer(1), Integer(k)));
+  }
+  assert(sum.numerator().isEqualTo(numerator));
+  assert(sum.denominator().isEqualTo(denominator));
+
+  constexpr int bufferSize = 1200;
+  char buffer[bufferSize];
+  int length = 0;
+  for (int k = 1; k <= 200; k++) {
+    length += strlcpy(buffer+length, k == 1 ? "1/" : "+1/", bufferSize-length);
+    length += Integer(k).writeTextInBuffer(buffer+length, bufferSize-length);
+  }
+  assert(length < bufferSize-1);
+  GlobalContext globalContext;
+  Expression * e = Expression::parse(buffer);
+  assert(e != nullptr);
+  Expression::Simplify(&e, globalContext, Radian);
+  assert(e->type() == Expression::Type::Rational);
+  assert(static_cast<Rational *>(e)->numerator().isEqualTo(numerator));
+  assert(static_cast<Rational *>(e)->denominator().isEqualTo(denominator));
+  delete e;
 }
@@ -1,5 +1,6 @@
 #include <quiz.h>
 #include <poincare.h>
+#include <poincare/evaluation.h>
 #include <cmath>
 #include <ion.h>
 #include <assert.h>
@@ -81,6 +82,27 @@ QUIZ_CASE(poincare_function_evaluate) {
 
   assert_parsed_expression_evaluates_to<float>("diff(2*x, 2)", "2");
   assert_parsed_expression_evaluates_to<double>("diff(2*x, 2)", "2");
+  assert_parsed_expression_evaluates_to<float>("diff(x^3-2*x, 2)", "10");
+  assert_parsed_expression_evaluates_to<double>("diff(x^3-2*x, 2)", "10");
+  assert_parsed_expression_evaluates_to<double>("diff(sin(x), 60)", "8.7266462599716E-3");
+  assert_parsed_expression_evaluates_to<double>("diff(ln(x)*R(x), 4)", "8.4657359027997E-1");
+  assert_parsed_expression_evaluates_to<double>("diff(2^x/tan(x), 3)", "-440.6109670988", Radian);
+  assert_parsed_expression_evaluates_to<double>("diff(log(x,3), 5)", "1.8204784532537E-1", Radian);
+  assert_parsed_expression_evaluates_to<float>("diff(abs(x), -2)", "-1");
+  assert_parsed_expression_evaluates_to<double>("diff(floor(x), 2.5)", "0");
+  assert_parsed_expression_evaluates_to<double>("diff(R(x), 0)", "undef");
+  assert_parsed_expression_evaluates_to<double>("diff(R(x), -1)", "undef");
+  assert_parsed_expression_evaluates_to<double>("diff(ln(x), -1)", "undef");
+  assert_parsed_expression_evaluates_to<double>("diff(log(x), -2)", "undef");
+  assert_parsed_expression_evaluates_to<double>("diff(abs(x), 0)", "undef");
+  assert_parsed_expression_evaluates_to<double>("diff(2*abs(x)+x, 0)", "undef");
+  {
+    // Without simplification, the kink of abs is not smoothed out numerically
+    GlobalContext globalContext;
+    Expression * e = parse_expression("diff(abs(x)+x, 0)");
+    assert(std::isnan(e->approximateToScalar<double>(globalContext, Radian)));
+    delete e;
+  }
 
 #if MATRICES_ARE_DEFINED
   assert_parsed_expression_evaluates_to<float>("det([[1,23,3][4,5,6][7,8,9]])", "126", Degree, Cartesian, 6); // FIXME: the determinant computation is not precised enough to be displayed with 7 significant digits
@@ -103,6 +125,8 @@ QUIZ_CASE(poincare_function_evaluate) {
 
   assert_parsed_expression_evaluates_to<float>("int(x, 1, 2)", "1.5");
   assert_parsed_expression_evaluates_to<double>("int(x, 1, 2)", "1.5");
+  assert_parsed_expression_evaluates_to<float>("int(1/x, 1, 1000)", "6.907755");
+  assert_parsed_expression_evaluates_to<double>("int(1/x, 0, 1)", "undef");
 
   assert_parsed_expression_evaluates_to<float>("lcm(234,394)", "46098");
   assert_parsed_expression_evaluates_to<double>("lcm(234,394)", "46098");
@@ -213,6 +237,8 @@ QUIZ_CASE(poincare_function_evaluate) {
 
   assert_parsed_expression_evaluates_to<float>("int(1+cos(x), 0, 180)", "180");
   assert_parsed_expression_evaluates_to<double>("int(1+cos(x), 0, 180)", "180");
+  // More subintervals than the quadrature keeps at once
+  assert_parsed_expression_evaluates_to<double>("int(abs(sin(2x)),0,50)", "31.932", Radian, Cartesian, 5);
 
   Expression * exp = parse_expression("random()");
   assert_exp_is_bounded(exp, 0.0f, 1.0f);
@@ -225,6 +251,118 @@ QUIZ_CASE(poincare_function_evaluate) {
   delete exp;
 }
 
+template<typename T>
+void assert_parsed_expression_program_matches_tree(const char * expression, bool compiled, Expression::AngleUnit angleUnit = Radian) {
+  GlobalContext globalContext;
+  Expression * e = parse_expression(expression);
+  ApproximationProgram<T> program(e, 'x', globalContext, angleUnit);
+  assert(program.isCompiled() == compiled);
+  constexpr int numberOfAbscissae = 11;
+  const T abscissae[numberOfAbscissae] = {-3, -1, -0.5, 0, 0.25, 1, 2.5, 10, -7, 1E30, INFINITY};
+  T batchResults[numberOfAbscissae];
+  program.approximateWithValuesForSymbol(abscissae, batchResults, numberOfAbscissae, globalContext);
+  for (int i = 0; i < numberOfAbscissae; i++) {
+    T treeResult = e->approximateWithValueForSymbol('x', abscissae[i], globalContext, angleUnit);
+    T programResult = program.approximateWithValueForSymbol(abscissae[i], globalContext);
+    assert((std::isnan(treeResult) && std::isnan(programResult)) || treeResult == programResult);
+    assert((std::isnan(treeResult) && std::isnan(batchResults[i])) || treeResult == batchResults[i]);
+  }
+  delete e;
+}
+
+QUIZ_CASE(poincare_function_approximation_program) {
+  assert_parsed_expression_program_matches_tree<float>("x^2+3*x-1", true);
+  assert_parsed_expression_program_matches_tree<double>("x^2+3*x-1", true);
+  assert_parsed_expression_program_matches_tree<double>("sin(x)+cos(2*x)/tan(x)", true);
+  assert_parsed_expression_program_matches_tree<double>("sin(x)*P", true, Degree);
+  assert_parsed_expression_program_matches_tree<double>("R(x)^2", true);
+  assert_parsed_expression_program_matches_tree<float>("ln(x)+log(x,2)-abs(x-1)", true);
+  assert_parsed_expression_program_matches_tree<double>("-1/x+floor(x)*(x)!", true);
+  assert_parsed_expression_program_matches_tree<double>("re(X^(I*x))+im(X^(I*x))", true);
+  assert_parsed_expression_program_matches_tree<float>("x*x*x*x-(-x)*2", true);
+  assert_parsed_expression_program_matches_tree<double>("(x+I)*(x-I)-x*0", true);
+  // Variables stored in the context are read at each run
+  GlobalContext globalContext;
+  Expression * e = parse_expression("A*x");
+  ApproximationProgram<double> program(e, 'x', globalContext, Radian);
+  assert(program.isCompiled());
+  Symbol a('A');
+  Rational two(2);
+  globalContext.setExpressionForSymbolName(&two, &a, globalContext);
+  assert(program.approximateWithValueForSymbol(3.0, globalContext) == 6.0);
+  Rational five(5);
+  globalContext.setExpressionForSymbolName(&five, &a, globalContext);
+  assert(program.approximateWithValueForSymbol(3.0, globalContext) == 15.0);
+  delete e;
+  // Fallback on the tree approximation
+  assert_parsed_expression_program_matches_tree<double>("int(x*x,0,x)", false);
+  assert_parsed_expression_program_matches_tree<double>("det([[x,1][2,x]])", false);
+}
+
+void assert_parsed_expression_interval_encloses_values(const char * expression, double lower, double upper, Expression::AngleUnit angleUnit = Radian) {
+  GlobalContext globalContext;
+  Expression * e = parse_expression(expression);
+  RealInterval interval = e->approximateIntervalForSymbol('x', lower, upper, globalContext, angleUnit);
+  constexpr int numberOfSamples = 100;
+  for (int i = 0; i <= numberOfSamples; i++) {
+    double x = lower + (upper - lower)*i/numberOfSamples;
+    double value = e->approximateWithValueForSymbol('x', x, globalContext, angleUnit);
+    assert(std::isnan(value) || interval.contains(value));
+    assert(!interval.isUndefined() || std::isnan(value));
+  }
+  delete e;
+}
+
+void assert_parsed_expression_has_root(const char * expression, double start, double step, double max, double root) {
+  GlobalContext globalContext;
+  Expression * e = parse_expression(expression);
+  double result = e->nextRoot('x', start, step, max, globalContext, Radian);
+  assert((std::isnan(root) && std::isnan(result)) || std::fabs(result - root) < 1E-6);
+  delete e;
+}
+
+QUIZ_CASE(poincare_function_approximate_interval) {
+  assert_parsed_expression_interval_encloses_values("x^2-2", -3.0, 2.0);
+  assert_parsed_expression_interval_encloses_values("x^3-x/3", -1.0, 1.5);
+  assert_parsed_expression_interval_encloses_values("sin(x)+cos(2*x)", -10.0, 10.0);
+  assert_parsed_expression_interval_encloses_values("sin(x)*cos(x)", 30.0, 95.0, Degree);
+  assert_parsed_expression_interval_encloses_values("ln(x)-log(x,3)", 0.5, 100.0);
+  assert_parsed_expression_interval_encloses_values("x^(1/3)+R(x)", 0.0, 8.0);
+  assert_parsed_expression_interval_encloses_values("abs(x-1)/(x+3)", -2.0, 4.0);
+  assert_parsed_expression_interval_encloses_values("2^x-X^(-x)", -5.0, 5.0);
+  // Interval bounds
+  GlobalContext globalContext;
+  Expression * e = parse_expression("x^2-2");
+  RealInterval interval = e->approximateIntervalForSymbol('x', -1.0, 1.0, globalContext, Radian);
+  assert(interval.lower() < -2.0 && interval.lower() > -2.0001);
+  assert(interval.upper() > -1.0 && interval.upper() < -0.9999);
+  delete e;
+  // Non-real intermediate values can lead to real values
+  e = parse_expression("R(x)^2");
+  interval = e->approximateIntervalForSymbol('x', -4.0, -1.0, globalContext, Radian);
+  assert(interval.contains(-2.0) && interval.contains(-4.0));
+  delete e;
+  e = parse_expression("1/(x-x)");
+  interval = e->approximateIntervalForSymbol('x', -4.0, -1.0, globalContext, Radian);
+  assert(interval.contains(0.0));
+  delete e;
+  // Expressions undefined on the whole interval
+  e = parse_expression("ln(-1)*x");
+  assert(e->approximateIntervalForSymbol('x', 1.0, 2.0, globalContext, Radian).isUndefined() == false);
+  delete e;
+  e = parse_expression("x*undef");
+  assert(e->approximateIntervalForSymbol('x', 1.0, 2.0, globalContext, Radian).isUndefined());
+  delete e;
+  // Roots are found on the pruned intervals as on the whole interval
+  assert_parsed_expression_has_root("x^2-2", 0.0, 0.1, 100.0, std::sqrt(2.0));
+  assert_parsed_expression_has_root("x^2-2", 0.0, -0.1, -100.0, -std::sqrt(2.0));
+  assert_parsed_expression_has_root("sin(x)", 0.5, 0.1, 100.0, M_PI);
+  assert_parsed_expression_has_root("x^2", -3.0, 0.1, 100.0, 0.0);
+  assert_parsed_expression_has_root("ln(x)", -20.0, 0.1, 100.0, 1.0);
+  assert_parsed_expression_has_root("x^2+1", -20.0, 0.1, 100.0, NAN);
+  assert_parsed_expression_has_root("1/x", -1.0, 0.1, 1.0, NAN);
+}
+
 QUIZ_CASE(poincare_function_simplify) {
   assert_parsed_expression_simplify_to("abs(P)", "P");
   assert_parsed_expression_simplify_to("abs(-P)", "P");
@@ -232,6 +370,28 @@ QUIZ_CASE(poincare_function_simplify) {
   assert_parsed_expression_simplify_to("binomial(20,10)", "184756");
   assert_parsed_expression_simplify_to("ceil(-1.3)", "-1");
   assert_parsed_expression_simplify_to("conj(1/2)", "1/2");
+  assert_parsed_expression_simplify_to("diff(x^2,x)", "2*x");
+  assert_parsed_expression_simplify_to("diff(x^2,3)", "6");
+  assert_parsed_expression_simplify_to("diff(3*x^3-x+2,x)", "(-1)+9*x^2");
+  assert_parsed_expression_simplify_to("diff(sin(x),x)", "cos(x)");
+  assert_parsed_expression_simplify_to("diff(cos(x),x)", "-(sin(x)*P)/180", Degree);
+  assert_parsed_expression_simplify_to("diff(ln(x),x)", "1/x");
+  assert_parsed_expression_simplify_to("diff(log(x),x)", "1/(ln(2)*x+ln(5)*x)");
+  assert_parsed_expression_simplify_to("diff(X^(2*x),x)", "2*X^(2*x)");
+  assert_parsed_expression_simplify_to("diff(2^x,x)", "2^x*ln(2)");
+  assert_parsed_expression_simplify_to("diff(x^x,x)", "x^x+ln(x)*x^x");
+  assert_parsed_expression_simplify_to("diff(R(x),x)", "1/(2*R(x))");
+  assert_parsed_expression_simplify_to("diff(R(x),-1)", "diff(R(x),-1)");
+  assert_parsed_expression_simplify_to("diff(atan(x),x)", "1/(1+x^2)");
+  assert_parsed_expression_simplify_to("diff(asin(x),x)", "180/(R(1-x^2)*P)", Degree);
+  assert_parsed_expression_simplify_to("diff(x*cosh(x),x)", "cosh(x)+sinh(x)*x");
+  assert_parsed_expression_simplify_to("diff(tanh(x),x)", "1/cosh(x)^2");
+  assert_parsed_expression_simplify_to("diff(abs(x),x)", "x/abs(x)");
+  assert_parsed_expression_simplify_to("diff(sin(x)^2,P)", "0");
+  assert_parsed_expression_simplify_to("diff(diff(x^3,x),x)", "6*x");
+  assert_parsed_expression_simplify_to("diff(floor(x),x)", "diff(floor(x),x)");
+  assert_parsed_expression_simplify_to("diff(int(x,0,x),2)", "diff(int(x,0,x),2)");
+  assert_parsed_expression_simplify_to("diff(x*int(x,0,1),x)", "int(x,0,1)");
   assert_parsed_expression_simplify_to("quo(19,3)", "6");
   assert_parsed_expression_simplify_to("quo(19,0)", "undef");
   assert_parsed_expression_simplify_to("quo(-19,3)", "-7");
@@ -242,7 +402,11 @@ QUIZ_CASE(poincare_function_simplify) {
   assert_parsed_expression_simplify_to("factor(-10008/6895)", "-(2^3*3^2*139)/(5*7*197)");
   assert_parsed_expression_simplify_to("factor(1008/6895)", "(2^4*3^2)/(5*197)");
   assert_parsed_expression_simplify_to("factor(10007)", "10007");
-  assert_parsed_expression_simplify_to("factor(10007^2)", "undef");
+  assert_parsed_expression_simplify_to("factor(10007^2)", "10007^2");
+  assert_parsed_expression_simplify_to("factor(28962645732620633153)", "4889989547*5922844099");
+  /* The prime factors of this semiprime are too big to be found by
+   * Pollard-Brent's rho method in a reasonable time. */
+  assert_parsed_expression_simplify_to("factor(619794633636213723997165365577)", "undef");
   assert_parsed_expression_simplify_to("floor(-1.3)", "-2");
   assert_parsed_expression_simplify_to("frac(-1.3)", "7/10");
   assert_parsed_expression_simplify_to("gcd(123,278)", "1");
@@ -262,3 +426,26 @@ QUIZ_CASE(poincare_function_simplify) {
   assert_parsed_expression_simplify_to("permute(20,-10)", "undef");
   assert_parsed_expression_simplify_to("re(1/2)", "1/2");
 }
+
+QUIZ_CASE(poincare_evaluation_arena) {
+  size_t offset = EvaluationArena::Offset();
+  {
+    EvaluationArena::Scope scope;
+    Evaluation<double> * c = new Complex<double>(1.0);
+    assert(EvaluationArena::Offset() > offset);
+    delete c;
+    assert(EvaluationArena::Offset() == offset);
+  }
+  GlobalContext globalContext;
+  Expression * e = parse_expression("sum(n^2+cos(n), 1, 1000)");
+  double sum = 0.0;
+  for (int n = 1; n <= 1000; n++) {
+    sum += n*n + std::cos(n);
+  }
+  assert(std::fabs(e->approximateToScalar<double>(globalContext, Radian) - sum) < 1E-12*sum);
+  delete e;
+  assert(EvaluationArena::Offset() == offset);
+  // Matrices keep their operands on the heap above 4 operands
+  assert_parsed_expression_evaluates_to<double>("[[1,2,3][4,5,6][7,8,9]]*[[1,2,3][4,5,6][7,8,9]]+[[1,2,3][4,5,6][7,8,9]]-[[1,2,3][4,5,6][7,8,9]]", "[[30,36,42][66,81,96][102,126,150]]");
+  assert(EvaluationArena::Offset() == offset);
+}
@@ -0,0 +1,76 @@
+#include <quiz.h>
+#include <poincare.h>
+#include <poincare_layouts.h>
+#include <ion.h>
+#include <assert.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+static void assert_layouts_have_same_geometry(ExpressionLayout * l1, ExpressionLayout * l2) {
+  assert(l1->numberOfChildren() == l2->numberOfChildren());
+  assert(l1->size().width() == l2->size().width());
+  assert(l1->size().height() == l2->size().height());
+  assert(l1->baseline() == l2->baseline());
+  assert(l1->absoluteOrigin().x() == l2->absoluteOrigin().x());
+  assert(l1->absoluteOrigin().y() == l2->absoluteOrigin().y());
+  for (int i = 0; i < l1->numberOfChildren(); i++) {
+    assert_layouts_have_same_geometry(l1->editableChild(i), l2->editableChild(i));
+  }
+}
+
+static void assert_layout_is_up_to_date(ExpressionLayout * layout) {
+  // A clone computes all its sizes, positions and baselines from scratch
+  ExpressionLayout * clone = layout->clone();
+  assert_layouts_have_same_geometry(layout, clone);
+  delete clone;
+}
+
+QUIZ_CASE(poincare_horizontal_layout_incremental_relayout) {
+  HorizontalLayout * layout = new HorizontalLayout();
+  ExpressionLayoutCursor cursor(layout, ExpressionLayoutCursor::Position::Left);
+  cursor.insertText("1+(2");
+  assert_layout_is_up_to_date(layout);
+  cursor.addFractionLayoutAndCollapseSiblings();
+  cursor.insertText("3");
+  assert_layout_is_up_to_date(layout);
+  cursor.addEmptyPowerLayout();
+  cursor.insertText("4");
+  assert_layout_is_up_to_date(layout);
+  bool shouldRecomputeLayout = false;
+  cursor = cursor.cursorOnRight(&shouldRecomputeLayout);
+  cursor = cursor.cursorOnRight(&shouldRecomputeLayout);
+  cursor.insertText(")*5");
+  assert_layout_is_up_to_date(layout);
+  cursor.addEmptyMatrixLayout(2, 2);
+  cursor.insertText("6");
+  assert_layout_is_up_to_date(layout);
+  cursor.performBackspace();
+  cursor.performBackspace();
+  assert_layout_is_up_to_date(layout);
+  cursor.clearLayout();
+  assert(layout->numberOfChildren() == 0);
+  assert(layout->size().width() == 0);
+  delete layout;
+}
+
+QUIZ_CASE(poincare_horizontal_layout_positions) {
+  HorizontalLayout * layout = new HorizontalLayout();
+  ExpressionLayoutCursor cursor(layout, ExpressionLayoutCursor::Position::Left);
+  cursor.insertText("12345678901234567890");
+  KDCoordinate x = 0;
+  for (int i = 0; i < layout->numberOfChildren(); i++) {
+    ExpressionLayout * child = layout->editableChild(i);
+    assert(child->origin().x() == x);
+    x += child->size().width();
+  }
+  assert(layout->size().width() == x);
+  // Inserting a char moves its next siblings only
+  KDCoordinate firstCharWidth = layout->editableChild(0)->size().width();
+  layout->addChildAtIndex(new CharLayout('0'), 5);
+  assert(layout->editableChild(4)->origin().x() == 4*firstCharWidth);
+  assert(layout->editableChild(6)->origin().x() == 6*firstCharWidth);
+  assert(layout->size().width() == x + firstCharWidth);
+  assert_layout_is_up_to_date(layout);
+  delete layout;
+}
@@ -1,6 +1,7 @@
 #include <quiz.h>
 #include <poincare.h>
 #include <assert.h>
+#include <string.h>
 
 using namespace Poincare;
 
@@ -91,6 +92,17 @@ QUIZ_CASE(poincare_integer_multiplication) {
   assert(Integer::Multiplication(Integer("-23456787654567765456"), Integer("0")).isEqualTo(Integer("0")));
 }
 
+QUIZ_CASE(poincare_integer_power) {
+  assert(Integer::Power(Integer(12), Integer(0)).isEqualTo(Integer(1)));
+  assert(Integer::Power(Integer(0), Integer(0)).isEqualTo(Integer(1)));
+  assert(Integer::Power(Integer(0), Integer(12)).isEqualTo(Integer(0)));
+  assert(Integer::Power(Integer(-3), Integer(3)).isEqualTo(Integer(-27)));
+  assert(Integer::Power(Integer(-3), Integer(4)).isEqualTo(Integer(81)));
+  assert(Integer::Power(Integer(2), Integer(64)).isEqualTo(Integer("18446744073709551616")));
+  assert(Integer::Power(Integer(3), Integer(100)).isEqualTo(Integer("515377520732011331036461129765621272702107522001")));
+  assert(Integer::Power(Integer("4294967296"), Integer(3)).isEqualTo(Integer::Power(Integer(2), Integer(96))));
+}
+
 QUIZ_CASE(poincare_integer_divide) {
   assert(Integer::Division(Integer(8), Integer(4)).quotient.isEqualTo(Integer(2)) && Integer::Division(Integer(8), Integer(4)).remainder.isEqualTo(Integer(0)));
   assert(Integer::Division(Integer("3293920983030066"), Integer(38928)).quotient.isEqualTo(Integer("84615726033")) && Integer::Division(Integer("3293920983030066"), Integer(38928)).remainder.isEqualTo(Integer(17442)));
@@ -114,6 +126,30 @@ QUIZ_CASE(poincare_integer_divide) {
   assert(Integer::Division(Integer("2305843009213693952"), Integer("2305843009213693921")).quotient.isEqualTo(Integer("1")) && Integer::Division(Integer("2305843009213693952"), Integer("2305843009213693921")).remainder.isEqualTo(Integer("31")));
 }
 
+static void assert_integer_prints_to(const Integer & i, const char * result, int bufferSize = 400) {
+  char buffer[400];
+  assert(bufferSize <= 400);
+  int length = i.writeTextInBuffer(buffer, bufferSize);
+  assert(strcmp(buffer, result) == 0);
+  assert(length == (int)strlen(result));
+}
+
+QUIZ_CASE(poincare_integer_write_text) {
+  assert_integer_prints_to(Integer(0), "0");
+  assert_integer_prints_to(Integer(-7), "-7");
+  assert_integer_prints_to(Integer("1000000000"), "1000000000");
+  assert_integer_prints_to(Integer("-4294967296"), "-4294967296");
+  assert_integer_prints_to(Integer("100000000000000000000000000000000000000001"), "100000000000000000000000000000000000000001");
+  const char * twoPower1000 = "10715086071862673209484250490600018105614048117055336074437503883703510511249361224931983788156958581275946729175531468251871452856923140435984577574698574803934567774824230985421074605062371141877954182153046474983581941267398767559165543946077062914571196477686542167660429831652624386837205668069376";
+  assert(Integer(twoPower1000).isEqualTo(Integer::Power(Integer(2), Integer(1000))));
+  assert_integer_prints_to(Integer::Power(Integer(2), Integer(1000)), twoPower1000);
+  assert_integer_prints_to(Integer::Power(Integer(-3), Integer(300)), "136891479058588375991326027382088315966463695625337436471480190078368997177499076593800206155688941388250484440597994042813512732765695774566001");
+  // The buffer is too small
+  assert_integer_prints_to(Integer(123456), "undef", 6);
+  assert_integer_prints_to(Integer(123456), "123456", 7);
+  assert_integer_prints_to(Integer(-123456), "undef", 7);
+}
+
 template<typename T>
 void assert_integer_evals_to(const char * i, bool negative, T result) {
   assert(Integer(i, negative).approximate<T>() == result);
@@ -155,3 +191,26 @@ QUIZ_CASE(poincare_integer_evaluate) {
   assert_integer_evals_to("4", false, 4.0f);
   assert_integer_evals_to("4", false, 4.0);
 }
+
+static void assert_multiplication_and_power_are_consistent(int numberOfDigits) {
+  // x = 10^n-1 so that x^2 = 10^2n-2*10^n+1
+  Integer tenPowerN = Integer::Power(Integer(10), Integer(numberOfDigits));
+  Integer x = Integer::Subtraction(tenPowerN, Integer(1));
+  Integer square = Integer::Multiplication(x, x);
+  Integer tenPower2N = Integer::Power(Integer(10), Integer(2*numberOfDigits));
+  Integer expected = Integer::Addition(Integer::Subtraction(tenPower2N, Integer::Multiplication(Integer(2), tenPowerN)), Integer(1));
+  assert(square.isEqualTo(expected));
+  // (x+1)^2 = 10^2n
+  assert(Integer::Multiplication(tenPowerN, tenPowerN).isEqualTo(tenPower2N));
+}
+
+QUIZ_CASE(poincare_integer_large_multiplication) {
+  assert_multiplication_and_power_are_consistent(100);
+  assert_multiplication_and_power_are_consistent(1000);
+  assert_multiplication_and_power_are_consistent(5000);
+  // Operands of very different sizes
+  Integer a = Integer::Power(Integer(7), Integer(3000));
+  Integer b = Integer::Power(Integer(7), Integer(500));
+  assert(Integer::Multiplication(a, b).isEqualTo(Integer::Power(Integer(7), Integer(3500))));
+  assert(Integer::Multiplication(b, a).isEqualTo(Integer::Multiplication(a, b)));
+}
@@ -36,10 +36,11 @@ QUIZ_CASE(poincare_logarithm_simplify) {
   assert_parsed_expression_simplify_to("log(10^24)", "24");
   assert_parsed_expression_simplify_to("log((23P)^4,23P)", "4");
   assert_parsed_expression_simplify_to("log(10^(2+P))", "2+P");
-  assert_parsed_expression_simplify_to("ln(1881676377434183981909562699940347954480361860897069)", "ln(1881676377434183981909562699940347954480361860897069)");
-  /* log(1002101470343) does no reduce to 3*log(10007) because it involves
-   * prime factors above k_biggestPrimeFactor */
-  assert_parsed_expression_simplify_to("log(1002101470343)", "log(1002101470343)");
+  assert_parsed_expression_simplify_to("ln(1881676377434183981909562699940347954480361860897069)", "6*ln(3)+3*ln(7)+3*ln(11)+3*ln(13)+3*ln(19)+3*ln(3607)+3*ln(3803)+3*ln(52579)");
+  assert_parsed_expression_simplify_to("log(1002101470343)", "3*log(10007)");
+  /* log(619794633636213723997165365577) does no reduce because its prime
+   * factors cannot be found in a reasonable time. */
+  assert_parsed_expression_simplify_to("log(619794633636213723997165365577)", "log(619794633636213723997165365577)");
   assert_parsed_expression_simplify_to("log(64,2)", "6");
   assert_parsed_expression_simplify_to("log(2,64)", "log(2,64)");
   assert_parsed_expression_simplify_to("log(1476225,5)", "2+10*log(3,5)");
@@ -107,3 +107,37 @@ QUIZ_CASE(poincare_matrix_simplify) {
 #endif
 #endif
 }
+
+static void assert_parsed_matrix_has_rank(const char * expression, int rank) {
+  GlobalContext globalContext;
+  Expression * e = parse_expression(expression);
+  assert(e->type() == Expression::Type::Matrix);
+  assert(static_cast<Matrix *>(e)->rank(globalContext, Radian, true) == rank);
+  delete e;
+}
+
+QUIZ_CASE(poincare_matrix_rank) {
+  assert_parsed_matrix_has_rank("[[0,0][0,0]]", 0);
+  assert_parsed_matrix_has_rank("[[1,2][2,4]]", 1);
+  assert_parsed_matrix_has_rank("[[1/2,1/3][1/4,1/6]]", 1);
+  assert_parsed_matrix_has_rank("[[0,1,2][0,2,4][1,0,0]]", 2);
+  assert_parsed_matrix_has_rank("[[1,2,3][4,5,6][7,8,10]]", 3);
+  assert_parsed_matrix_has_rank("[[1,1/2,1/3,1/4,1/5][1/2,1/3,1/4,1/5,1/6][1/3,1/4,1/5,1/6,1/7][1/4,1/5,1/6,1/7,1/8][1/5,1/6,1/7,1/8,1/9]]", 5);
+  assert_parsed_matrix_has_rank("[[1,x][2,2*x]]", 1);
+}
+
+QUIZ_CASE(poincare_matrix_linear_algebra) {
+#if MATRICES_ARE_DEFINED
+  // Partial pivoting
+  assert_parsed_expression_evaluates_to<double>("det([[0,1][1,0]])", "-1");
+  assert_parsed_expression_evaluates_to<double>("det([[1,2][2,4]])", "0");
+  assert_parsed_expression_evaluates_to<double>("inverse([[0,1,2][1,0,3][4,-3,8]])", "[[-4.5,7,-1.5][-2,4,-1][1.5,-2,0.5]]");
+  assert_parsed_expression_evaluates_to<float>("inverse([[1,2][2,4]])", "undef");
+  // Binary powering
+  assert_parsed_expression_evaluates_to<double>("[[1,1][1,0]]^20", "[[10946,6765][6765,4181]]");
+  assert_parsed_expression_evaluates_to<float>("[[I,0][0,2]]^3", "[[-I,0][0,8]]");
+  assert_parsed_expression_evaluates_to<double>("[[1,2][3,4]]^0", "[[1,0][0,1]]");
+  // Blocked product of matrices larger than a block
+  assert_parsed_expression_evaluates_to<double>("[[1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1]]*transpose([[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20]])", "[[210]]");
+#endif
+}
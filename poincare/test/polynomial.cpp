@@ -0,0 +1,108 @@
+#include <quiz.h>
+#include <poincare.h>
+#include <assert.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+static Polynomial parse_polynomial(const char * text) {
+  GlobalContext globalContext;
+  Expression * e = parse_expression(text);
+  Expression::Reduce(&e, globalContext, Radian);
+  Polynomial p;
+  bool isPolynomial = Polynomial::FromExpression(e, &p);
+  assert(isPolynomial);
+  delete e;
+  return p;
+}
+
+static void assert_polynomials_are_equal(const Polynomial & p, const char * text) {
+  assert(Polynomial::Subtraction(p, parse_polynomial(text)).isZero());
+}
+
+QUIZ_CASE(poincare_polynomial_conversion) {
+  GlobalContext globalContext;
+  Polynomial p;
+  const char * notPolynomials[] = {"R(x)+1", "1/x", "cos(x)", "x^y", "I*x+1"};
+  for (const char * text : notPolynomials) {
+    Expression * e = parse_expression(text);
+    Expression::Reduce(&e, globalContext, Radian);
+    assert(!Polynomial::FromExpression(e, &p));
+    delete e;
+  }
+  p = parse_polynomial("2*x^3*y-x/3+7");
+  assert(p.numberOfTerms() == 3);
+  assert(p.degree('x') == 3 && p.degree('y') == 1 && p.degree('z') == 0);
+  assert(!p.isUnivariate());
+  Expression * e = p.createExpression();
+  Expression::Simplify(&e, globalContext, Radian);
+  Expression * f = parse_expression("2*x^3*y-x/3+7");
+  Expression::Simplify(&f, globalContext, Radian);
+  assert(e->isIdenticalTo(f));
+  delete e;
+  delete f;
+}
+
+QUIZ_CASE(poincare_polynomial_arithmetic) {
+  Polynomial a = parse_polynomial("x+y+1");
+  Polynomial b = parse_polynomial("x-y");
+  assert_polynomials_are_equal(Polynomial::Addition(a, b), "2x+1");
+  assert_polynomials_are_equal(Polynomial::Subtraction(a, b), "2y+1");
+  assert_polynomials_are_equal(Polynomial::Multiplication(a, b), "x^2-y^2+x-y");
+  assert_polynomials_are_equal(Polynomial::Power(b, 3), "x^3-3x^2*y+3x*y^2-y^3");
+  assert(Polynomial::Power(a, 12).numberOfTerms() == 91);
+  assert(Polynomial::Subtraction(a, a).isZero());
+}
+
+QUIZ_CASE(poincare_polynomial_division) {
+  PolynomialDivision d = Polynomial::Division(parse_polynomial("x^3-2x^2+4"), parse_polynomial("x-3"));
+  assert_polynomials_are_equal(d.quotient, "x^2+x+3");
+  assert_polynomials_are_equal(d.remainder, "13");
+  d = Polynomial::Division(parse_polynomial("x^2-1"), parse_polynomial("2x+2"));
+  assert_polynomials_are_equal(d.quotient, "x/2-1/2");
+  assert(d.remainder.isZero());
+  d = Polynomial::Division(parse_polynomial("x^2+1"), parse_polynomial("3"));
+  assert_polynomials_are_equal(d.quotient, "x^2/3+1/3");
+  assert(d.remainder.isZero());
+  assert_polynomials_are_equal(Polynomial::GCD(parse_polynomial("2x^2-2"), parse_polynomial("3x^2+6x+3")), "x+1");
+  assert_polynomials_are_equal(Polynomial::GCD(parse_polynomial("x^2+1"), parse_polynomial("x+1")), "1");
+  assert_polynomials_are_equal(Polynomial::GCD(parse_polynomial("x^3-x"), parse_polynomial("0")), "x^3-x");
+}
+
+QUIZ_CASE(poincare_polynomial_simplify) {
+  assert_parsed_expression_simplify_to("(x+1)^2", "1+2*x+x^2");
+  assert_parsed_expression_simplify_to("(x+y)^3", "x^3+3*x^2*y+3*x*y^2+y^3");
+  assert_parsed_expression_simplify_to("(x+1)^(-2)", "1/(1+2*x+x^2)");
+  assert_parsed_expression_simplify_to("(x+1)*(x-1)*(x+2)", "(-2)-x+2*x^2+x^3");
+
+  GlobalContext globalContext;
+  Expression * e = parse_expression("(x+y+1)^5");
+  Expression::Reduce(&e, globalContext, Radian);
+  assert(e->type() == Expression::Type::Addition && e->numberOfOperands() == 21);
+  delete e;
+}
+
+QUIZ_CASE(poincare_polynomial_multinome_limit) {
+  // Multinomes with more than 25 terms are not expanded
+  assert_parsed_expression_simplify_to("(x+1)^26", "(1+x)^26");
+  assert_parsed_expression_simplify_to("(x+1)^(-30)", "1/(1+x)^30");
+  assert_parsed_expression_simplify_to("x*(x+1)^26", "x*(1+x)^26");
+  assert_parsed_expression_simplify_to("(x+y+1)^12", "(1+x+y)^12");
+  // The expanded form would lose the result in cancellations
+  GlobalContext globalContext;
+  Expression * e = parse_expression("(x+1)^26");
+  Expression::Simplify(&e, globalContext, Radian);
+  assert(e->approximateWithValueForSymbol<double>('x', -2.0, globalContext, Radian) == 1.0);
+  delete e;
+}
+
+QUIZ_CASE(poincare_polynomial_too_many_variables) {
+  GlobalContext globalContext;
+  Polynomial p;
+  // Seven variables do not fit in a polynomial
+  Expression * e = parse_expression("A+B+C+D+F+G+H");
+  Expression::Reduce(&e, globalContext, Radian);
+  assert(!Polynomial::FromExpression(e, &p));
+  delete e;
+  assert_parsed_expression_simplify_to("2*(A+B+C+D+F+G+H)", "2*A+2*B+2*C+2*D+2*F+2*G+2*H");
+}
@@ -39,7 +39,9 @@ QUIZ_CASE(poincare_polynomial_degree) {
   assert_parsed_expression_polynomial_degree("cos(2)+1", 0);
   assert_parsed_expression_polynomial_degree("confidence(0.2,10)+1", -1);
   assert_parsed_expression_polynomial_degree("diff(3*x+x,2)", 0);
-  assert_parsed_expression_polynomial_degree("diff(3*x+x,x)", -1);
+  assert_parsed_expression_polynomial_degree("diff(3*x+x,x)", 0);
+  assert_parsed_expression_polynomial_degree("diff(x^3+x,x)", 2);
+  assert_parsed_expression_polynomial_degree("diff(floor(x),x)", -1);
   assert_parsed_expression_polynomial_degree("(3*x+2)/3", 1);
   assert_parsed_expression_polynomial_degree("(3*x+2)/x", -1);
   assert_parsed_expression_polynomial_degree("int(2*x, 0, 1)", 0);
@@ -132,3 +134,34 @@ QUIZ_CASE(poincare_get_polynomial_coefficients) {
   const char * coefficient3[] = {"1", "-P", "1", 0}; //x^2-Pi*x+1
   assert_parsed_expression_has_polynomial_coefficient("x^2-P*x+1", 'x', coefficient3);
 }
+
+void assert_parsed_expressions_are_identical(const char * expression1, const char * expression2, bool identical) {
+  Expression * e1 = parse_expression(expression1);
+  Expression * e2 = parse_expression(expression2);
+  assert(e1->isIdenticalTo(e2) == identical);
+  assert(!identical || e1->hash() == e2->hash());
+  delete e1;
+  delete e2;
+}
+
+QUIZ_CASE(poincare_identical_expressions) {
+  assert_parsed_expressions_are_identical("x^2+3*x+1", "x^2+3*x+1", true);
+  assert_parsed_expressions_are_identical("x^2+3*x+1", "x^2+3*x+2", false);
+  assert_parsed_expressions_are_identical("x^2+3*x+1", "x^2+3*y+1", false);
+  assert_parsed_expressions_are_identical("2/4", "2/4", true);
+  assert_parsed_expressions_are_identical("1.5E3", "1.5E3", true);
+  assert_parsed_expressions_are_identical("1.5E3", "1.6E3", false);
+  assert_parsed_expressions_are_identical("log(2)", "log(2,10)", false);
+  assert_parsed_expressions_are_identical("cos(x)", "sin(x)", false);
+
+  // Modifying a descendant discards the cached hashes of its ancestors
+  Expression * e1 = parse_expression("cos(2+3)");
+  Expression * e2 = parse_expression("cos(2+4)");
+  assert(!e1->isIdenticalTo(e2));
+  Expression * addition = e1->editableOperand(0);
+  addition->replaceOperand(addition->operand(1), new Rational(4), true);
+  assert(e1->hash() == e2->hash());
+  assert(e1->isIdenticalTo(e2));
+  delete e1;
+  delete e2;
+}
@@ -56,3 +56,20 @@ QUIZ_CASE(poincare_simplify_mix) {
   //assert_parsed_expression_simplify_to("1/R(I) * (R(2)-I*R(2))", "-2I"); // TODO: get rid of complex at denominator?
 
 }
+
+QUIZ_CASE(poincare_simplify_deadline) {
+  GlobalContext globalContext;
+  // A simplification still running after the deadline is interrupted
+  Expression * e = parse_expression("x+3+2*x");
+  Expression::setProcessingDeadline(0);
+  Expression::Simplify(&e, globalContext, Radian);
+  Expression::clearProcessingDeadline();
+  assert(e == nullptr);
+
+  e = parse_expression("x+3+2*x");
+  Expression::setProcessingDeadline(60000);
+  Expression::Simplify(&e, globalContext, Radian);
+  Expression::clearProcessingDeadline();
+  assert(e != nullptr);
+  delete e;
+}
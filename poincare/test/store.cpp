@@ -15,3 +15,41 @@ QUIZ_CASE(poincare_store_simplify) {
   assert_parsed_expression_simplify_to("1+2>A", "A");
   assert_parsed_expression_simplify_to("1+2>x", "x");
 }
+
+Expression * parse_and_simplify(const char * expression, Context & context, Expression::AngleUnit angleUnit) {
+  char buffer[200];
+  strlcpy(buffer, expression, sizeof(buffer));
+  translate_in_special_chars(buffer);
+  return Expression::ParseAndSimplify(buffer, context, angleUnit);
+}
+
+QUIZ_CASE(poincare_store_simplification_cache) {
+  GlobalContext globalContext;
+  SimplificationCache * cache = globalContext.simplificationCache();
+  Expression * e = parse_and_simplify("2+B+3+B", globalContext, Degree);
+  Expression * cached = cache->simplifiedExpression("2+B+3+B", Degree);
+  assert(cached != nullptr && cached->isIdenticalTo(e));
+  delete cached;
+  assert(cache->simplifiedExpression("2+B+3+B", Radian) == nullptr);
+
+  // Storing an unrelated symbol keeps the entry
+  delete parse_and_simplify("3>C", globalContext, Degree);
+  cached = cache->simplifiedExpression("2+B+3+B", Degree);
+  assert(cached != nullptr);
+  delete cached;
+
+  // Storing a symbol the text depends on discards the entry
+  delete parse_and_simplify("3>B", globalContext, Degree);
+  assert(cache->simplifiedExpression("2+B+3+B", Degree) == nullptr);
+  delete e;
+
+  // A factorization cut short by the processing deadline is not cached
+  Expression::setProcessingDeadline(0);
+  delete parse_and_simplify("factor(28962645732620633153)", globalContext, Degree);
+  Expression::clearProcessingDeadline();
+  assert(cache->simplifiedExpression("factor(28962645732620633153)", Degree) == nullptr);
+  delete parse_and_simplify("factor(28962645732620633153)", globalContext, Degree);
+  cached = cache->simplifiedExpression("factor(28962645732620633153)", Degree);
+  assert(cached != nullptr && cached->type() == Expression::Type::Multiplication);
+  delete cached;
+}
@@ -4,14 +4,18 @@ extern "C" {
 #include "mphalport.h"
 }
 
+/* Reading the clock on each bytecode loop would still be noticeable: the
+ * cached scan is only queried once every few calls. */
+static constexpr int k_numberOfCallsBetweenScans = 256;
+
 void micropython_port_should_interrupt() {
   static int c = 0;
   c++;
-  if (c%20000 != 0) {
+  if (c%k_numberOfCallsBetweenScans != 0) {
     return;
   }
   c = 0;
-  Ion::Keyboard::State scan = Ion::Keyboard::scan();
+  Ion::Keyboard::State scan = Ion::Keyboard::cachedScan();
   if (scan.keyDown((Ion::Keyboard::Key)mp_interrupt_char)) {
     mp_keyboard_interrupt();
   }
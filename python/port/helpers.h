@@ -5,8 +5,9 @@
 extern "C" {
 #endif
 
-/* should_interrupt effectively does something once every 20000 calls. It checks
- * if a key is down to raise an interruption flag. */
+/* should_interrupt effectively does something once every 256 calls. It checks
+ * if a key is down to raise an interruption flag. The keyboard itself is only
+ * scanned once every Ion::Keyboard::k_cachedScanLifetime milliseconds. */
 void micropython_port_should_interrupt();
 
 #ifdef __cplusplus